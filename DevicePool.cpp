@@ -0,0 +1,88 @@
+//DevicePool.cpp
+//implements DevicePool functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DEVICEPOOL_CPP
+#define CLASS_DEVICEPOOL_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "DevicePool.h"
+
+using namespace std;
+
+DevicePool::DevicePool
+   (
+    // no parameters
+   )
+       : units( 0 )
+{
+	// initializers used
+}
+
+void DevicePool::init
+   (
+    int unitCount
+   )
+{
+    int unit;
+
+    units = unitCount;
+    freeUnits.clear();
+    freeUnits.reserve( unitCount );
+    waiting.clear();
+
+    //unit 0 on top, so units are first handed out in order
+    for( unit = unitCount - 1; unit >= 0; unit-- )
+    {
+        freeUnits.push_back( unit );
+    }
+}
+
+bool DevicePool::request
+   (
+    void *job,
+    int &unit
+   )
+{
+    if( freeUnits.empty() )
+    {
+        waiting.enqueue( job );
+        return false;
+    }
+
+    unit = freeUnits.back();
+    freeUnits.pop_back();
+
+    return true;
+}
+
+void* DevicePool::release
+   (
+    int unit
+   )
+{
+    void *job;
+
+    if( waiting.dequeue( job ) ) //the unit stays busy
+    {
+        return job;
+    }
+
+    freeUnits.push_back( unit );
+
+    return NULL;
+}
+
+int DevicePool::getUnitCount
+   (
+    // no parameters
+   ) const
+{
+    return units;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DEVICEPOOL_CPP
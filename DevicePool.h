@@ -0,0 +1,70 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file DevicePool.h
+ *
+ * @brief Definition file for DevicePool class
+ *
+ * @details Specifies a set of identical I/O device units, such as the hard
+ *          drives or the printers. Free unit numbers are kept on a stack,
+ *          so taking and returning a unit is constant time however many
+ *          units there are. A request that finds every unit busy waits in
+ *          the pool's own queue, not on a thread, and a returned unit goes
+ *          straight to the oldest waiting request. A request is handed to
+ *          a worker only once it holds a unit, so requests for a busy
+ *          device can't hold up requests for an idle one.
+ *
+ * @Note Not locked, the caller guards it
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DEVICEPOOL_H
+#define CLASS_DEVICEPOOL_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "SimpleQueue.cpp"
+
+using namespace std;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class DevicePool
+   {
+    public:
+
+    // constructors
+    DevicePool();
+
+    // modifiers
+
+       // makes every unit free and drops waiting requests
+       void init( int unitCount );
+
+       // takes a free unit for a request, or queues the request until one
+       //   is returned
+       // returns true and sets unit, starting from 0, if a unit was free
+       bool request( void *job, int &unit );
+
+       // returns a unit, handing it to the oldest queued request
+       // returns that request, or NULL if none was waiting
+       void* release( int unit );
+
+    // accessors
+
+       int getUnitCount() const;
+
+    private:
+
+       int units;
+       vector<int> freeUnits; //stack, the next unit handed out is last
+       SimpleQueue<void*> waiting; //requests in arrival order
+
+       DevicePool( const DevicePool &copiedPool );
+       const DevicePool &operator = ( const DevicePool &rhPool );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DEVICEPOOL_H
@@ -0,0 +1,137 @@
+//DeviceRegistry.cpp
+//implements DeviceRegistry functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DEVICEREGISTRY_CPP
+#define CLASS_DEVICEREGISTRY_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "DeviceRegistry.h"
+
+using namespace std;
+
+DeviceRegistry::DeviceRegistry
+   (
+    // no parameters
+   )
+       : types( DEVICE_LIMIT ), present( DEVICE_LIMIT, false ),
+         nextOperation( OP_UNKNOWN + 1 )
+{
+	// initializers used
+}
+
+void DeviceRegistry::set
+   (
+    unsigned char operation,
+    const DeviceType &type
+   )
+{
+    pair<unordered_map<string, unsigned char>::iterator, bool> entry;
+
+    if( present[operation] && lookup( types[operation].name ) == operation )
+    {
+        names.erase( types[operation].name );
+    }
+
+    types[operation] = type;
+    present[operation] = true;
+
+    //a name shared by several devices stays with the lowest identifier
+    entry = names.insert( make_pair( type.name, operation ) );
+    if( !entry.second && operation < entry.first->second )
+    {
+        entry.first->second = operation;
+    }
+}
+
+unsigned char DeviceRegistry::add
+   (
+    const DeviceType &type
+   )
+{
+    unsigned char operation = lookup( type.name );
+
+    if( operation != OP_UNKNOWN )
+    {
+        set( operation, type );
+        return operation;
+    }
+
+    if( nextOperation >= DEVICE_LIMIT )
+    {
+        return OP_UNKNOWN;
+    }
+
+    set( nextOperation, type );
+
+    return nextOperation++;
+}
+
+unsigned char DeviceRegistry::find
+   (
+    char code,
+    string_view name
+   ) const
+{
+    unsigned char operation = lookup( name );
+
+    if( operation != OP_UNKNOWN
+            && ( ( code == 'I' && types[operation].input )
+                 || ( code == 'O' && types[operation].output ) ) )
+    {
+        return operation;
+    }
+
+    return OP_UNKNOWN;
+}
+
+bool DeviceRegistry::isDevice
+   (
+    unsigned char operation
+   ) const
+{
+    return present[operation];
+}
+
+const DeviceType &DeviceRegistry::get
+   (
+    unsigned char operation
+   ) const
+{
+    return types[operation];
+}
+
+int DeviceRegistry::getUnitCount
+   (
+    // no parameters
+   ) const
+{
+    int operation, count = 0;
+
+    for( operation = 0; operation < DEVICE_LIMIT; operation++ )
+    {
+        if( present[operation] )
+        {
+            count += types[operation].units;
+        }
+    }
+
+    return count;
+}
+
+unsigned char DeviceRegistry::lookup
+   (
+    string_view name
+   ) const
+{
+    unordered_map<string, unsigned char>::const_iterator found
+            = names.find( string( name ) );
+
+    return ( found != names.end() ) ? found->second : OP_UNKNOWN;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DEVICEREGISTRY_CPP
@@ -0,0 +1,101 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file DeviceRegistry.h
+ *
+ * @brief Definition file for DeviceRegistry class
+ *
+ * @details Specifies the table of I/O device types the simulator knows. A
+ *          device type has the descriptor used in the metadata, a unit
+ *          label for the log, a unit count, a cycle time and whether it
+ *          takes input, output or both. The hard drive, keyboard, monitor
+ *          and printer keep their fixed operation identifiers, types added
+ *          from the configuration file get the identifiers after
+ *          OP_UNKNOWN. Descriptors are looked up by name once while the
+ *          metadata is parsed, and the simulator then indexes the table by
+ *          operation.
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DEVICEREGISTRY_H
+#define CLASS_DEVICEREGISTRY_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "MetaData.h"
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//operation identifiers available to devices, one byte in the log
+static const int DEVICE_LIMIT = 256;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//one kind of I/O device
+struct DeviceType
+{
+    string name; //metadata descriptor, "hard drive"
+    string label; //unit label in the log, "HDD", empty for no unit number
+    int units;
+    int cycleTime; //msec
+    bool input; //allowed with code I
+    bool output; //allowed with code O
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class DeviceRegistry
+   {
+    public:
+
+    // constructors
+    DeviceRegistry();
+
+    // modifiers
+
+       // sets the device with a fixed operation identifier
+       void set( unsigned char operation, const DeviceType &type );
+
+       // replaces the device with the same name, or adds it after the
+       //   fixed ones
+       // returns its operation identifier, OP_UNKNOWN if the table is full
+       unsigned char add( const DeviceType &type );
+
+    // accessors
+
+       // returns the operation identifier of a device for an I or O code,
+       //   OP_UNKNOWN if there is no such device or it can't do that
+       unsigned char find( char code, string_view name ) const;
+
+       bool isDevice( unsigned char operation ) const;
+
+       const DeviceType &get( unsigned char operation ) const;
+
+       // total units of every device
+       int getUnitCount() const;
+
+    private:
+
+       // returns the operation identifier of the device with a name,
+       //   OP_UNKNOWN if there is none
+       unsigned char lookup( string_view name ) const;
+
+       vector<DeviceType> types; //indexed by operation identifier
+       vector<bool> present;
+       int nextOperation; //identifier the next added device gets
+       unordered_map<string, unsigned char> names; //operation of each
+                                                   //  name, the lowest if
+                                                   //  several share it
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DEVICEREGISTRY_H
@@ -0,0 +1,248 @@
+//DiskScheduler.cpp
+//implements DiskScheduler functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DISKSCHEDULER_CPP
+#define CLASS_DISKSCHEDULER_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <algorithm>
+#include "DiskScheduler.h"
+
+using namespace std;
+
+DiskScheduler::DiskScheduler
+   (
+    // no parameters
+   )
+       : clock( NULL ), drives( NULL ), driveCount( 0 ), policy( DISK_FCFS ),
+         tracks( 1 )
+{
+	// initializers used
+}
+
+DiskScheduler::~DiskScheduler
+   (
+    // no parameters
+   )
+{
+    delete[] drives;
+}
+
+void DiskScheduler::init
+   (
+    SimClock *simClock,
+    int count,
+    int policyId,
+    int trackCount
+   )
+{
+    int index;
+
+    clock = simClock;
+    driveCount = count;
+    policy = policyId;
+    tracks = trackCount;
+    drives = new Drive[count];
+
+    for( index = 0; index < count; index++ )
+    {
+        drives[index].head = 0;
+        drives[index].up = true;
+        drives[index].busy = false;
+        drives[index].requests = 0;
+        drives[index].seekTotal = 0;
+        drives[index].waitTotal = 0;
+    }
+}
+
+bool DiskScheduler::request
+   (
+    void *job,
+    int track,
+    int &drive,
+    int &distance
+   )
+{
+    DiskRequest request;
+    int index;
+    unsigned int load, least = 0;
+
+    //the drive with the fewest requests outstanding, lowest first on a tie
+    drive = 0;
+    for( index = 0; index < driveCount; index++ )
+    {
+        load = drives[index].waiting.size() + ( drives[index].busy ? 1 : 0 );
+        if( index == 0 || load < least )
+        {
+            drive = index;
+            least = load;
+        }
+    }
+
+    request.job = job;
+    request.track = ( track < 0 ) ? -1 : min( track, tracks - 1 );
+    request.arrival = clock->now();
+
+    if( drives[drive].busy )
+    {
+        drives[drive].waiting.push_back( request );
+        return false;
+    }
+
+    drives[drive].busy = true;
+    distance = ( request.track < 0 ) ? 0
+                                     : abs( request.track - drives[drive].head );
+    serve( drives[drive], request, distance );
+
+    return true;
+}
+
+void* DiskScheduler::release
+   (
+    int drive,
+    int &distance
+   )
+{
+    if( drives[drive].waiting.empty() )
+    {
+        drives[drive].busy = false;
+        return NULL;
+    }
+
+    return pick( drives[drive], distance );
+}
+
+int DiskScheduler::getDriveCount
+   (
+    // no parameters
+   ) const
+{
+    return driveCount;
+}
+
+long DiskScheduler::getRequests
+   (
+    int drive
+   ) const
+{
+    return drives[drive].requests;
+}
+
+long DiskScheduler::getSeekTotal
+   (
+    int drive
+   ) const
+{
+    return drives[drive].seekTotal;
+}
+
+long DiskScheduler::getWaitTotal
+   (
+    int drive
+   ) const
+{
+    return drives[drive].waitTotal;
+}
+
+void* DiskScheduler::pick
+   (
+    Drive &drive,
+    int &distance
+   )
+{
+    vector<DiskRequest> &waiting = drive.waiting;
+    unsigned int index, best = 0, nearest = 0, lowest = 0;
+    int track, gap, bestGap = 0, nearestGap = 0, lowestTrack = 0, edge;
+    bool ahead, found = false;
+    DiskRequest request;
+
+    //ties go to the request that arrived first
+    for( index = 0; index < waiting.size(); index++ )
+    {
+        //a request for no track in particular is read where the head is
+        track = ( waiting[index].track < 0 ) ? drive.head
+                                              : waiting[index].track;
+        gap = abs( track - drive.head );
+
+        if( policy == DISK_FCFS )
+        {
+            ahead = ( index == 0 );
+        }
+        else if( policy == DISK_SSTF )
+        {
+            ahead = true;
+        }
+        else if( policy == DISK_SCAN )
+        {
+            ahead = drive.up ? track >= drive.head : track <= drive.head;
+        }
+        else //DISK_CLOOK only sweeps up
+        {
+            ahead = track >= drive.head;
+        }
+
+        if( ahead && ( !found || gap < bestGap ) )
+        {
+            best = index;
+            bestGap = gap;
+            found = true;
+        }
+        if( index == 0 || gap < nearestGap )
+        {
+            nearest = index;
+            nearestGap = gap;
+        }
+        if( index == 0 || track < lowestTrack )
+        {
+            lowest = index;
+            lowestTrack = track;
+        }
+    }
+
+    distance = bestGap;
+    if( !found && policy == DISK_SCAN )
+    {
+        //on to the last track, then back past the head to the nearest
+        edge = drive.up ? tracks - 1 : 0;
+        best = nearest;
+        distance = 2 * abs( edge - drive.head ) + nearestGap;
+    }
+    else if( !found ) //DISK_CLOOK jumps back to the lowest request
+    {
+        best = lowest;
+        distance = drive.head - lowestTrack;
+    }
+
+    request = waiting[best];
+    waiting.erase( waiting.begin() + best );
+    serve( drive, request, distance );
+
+    return request.job;
+}
+
+void DiskScheduler::serve
+   (
+    Drive &drive,
+    const DiskRequest &request,
+    int distance
+   )
+{
+    //the head keeps sweeping the way it last moved
+    if( request.track >= 0 && request.track != drive.head )
+    {
+        drive.up = ( request.track > drive.head );
+        drive.head = request.track;
+    }
+
+    drive.requests++;
+    drive.seekTotal += distance;
+    drive.waitTotal += clock->now() - request.arrival;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DISKSCHEDULER_CPP
@@ -0,0 +1,124 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file DiskScheduler.h
+ *
+ * @brief Definition file for DiskScheduler class
+ *
+ * @details Specifies the hard drives when disk scheduling is simulated. Each
+ *          drive has its own request queue and head position. A request is
+ *          queued on the drive with the fewest requests outstanding, and
+ *          when a drive finishes one it picks the next by the policy: FCFS
+ *          in arrival order, SSTF the nearest track, SCAN sweeping to the
+ *          last track and back, C-LOOK sweeping up and jumping back to the
+ *          lowest waiting track. The tracks the head moves and the time a
+ *          request waits in the queue, from when it was issued, are counted
+ *          per drive. A request is queued as soon as it is issued, not from
+ *          a worker, so the policy can choose among all of them, and it is
+ *          handed back to the caller once its drive picks it.
+ *
+ * @Note Not locked, the caller guards it
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_DISKSCHEDULER_H
+#define CLASS_DISKSCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "SimClock.h"
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//disk scheduling policies
+static const int DISK_FCFS = 0,
+                 DISK_SSTF = 1,
+                 DISK_SCAN = 2,
+                 DISK_CLOOK = 3;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class DiskScheduler
+   {
+    public:
+
+    // constructors
+    DiskScheduler();
+
+    // destructor
+    ~DiskScheduler();
+
+    // modifiers
+
+       // sets the clock used to time requests, the drives, policy and
+       //   tracks on each drive, every head starts on track 0
+       void init( SimClock *simClock, int count, int policyId,
+                  int trackCount );
+
+       // queues a request for a track, -1 for wherever the head is, on the
+       //   drive with the fewest requests outstanding
+       // returns true if that drive was idle and took it at once, drive
+       //   and distance are then set to the drive and the tracks the head
+       //   moved
+       bool request( void *job, int track, int &drive, int &distance );
+
+       // finishes the request on a drive, it picks its next one
+       // returns the request it picked, distance set to the tracks the
+       //   head moved, or NULL if none were waiting
+       void* release( int drive, int &distance );
+
+    // accessors
+
+       int getDriveCount() const;
+
+       // requests served, tracks moved and usec spent queued on a drive
+       long getRequests( int drive ) const;
+       long getSeekTotal( int drive ) const;
+       long getWaitTotal( int drive ) const;
+
+    private:
+
+       // one request waiting for its drive
+       struct DiskRequest
+       {
+           void *job;
+           int track;
+           long arrival; //clock time it was queued
+       };
+
+       // one drive and its queue
+       struct Drive
+       {
+           vector<DiskRequest> waiting; //in arrival order
+           int head;
+           bool up; //SCAN sweep direction
+           bool busy;
+           long requests;
+           long seekTotal;
+           long waitTotal;
+       };
+
+       SimClock *clock;
+       Drive *drives;
+       int driveCount;
+       int policy;
+       int tracks;
+
+       // takes the next request of a drive off its queue by the policy
+       //   and moves the head to it
+       // returns the request, distance set to the tracks the head moved
+       void* pick( Drive &drive, int &distance );
+
+       // moves the head of a drive to a request and counts it
+       void serve( Drive &drive, const DiskRequest &request, int distance );
+
+       DiskScheduler( const DiskScheduler &copiedScheduler );
+       const DiskScheduler &operator = ( const DiskScheduler &rhScheduler );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_DISKSCHEDULER_H
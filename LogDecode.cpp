@@ -0,0 +1,104 @@
+//LogDecode.cpp
+//Turns a binary simulator log back into the text log
+//Input: Binary log file written by Sim04 with Log format: Binary
+//Output: Text log, the same lines Sim04 writes in text mode, on the monitor
+//            or in the file named by the second argument
+
+#include <iostream>
+#include <fstream>
+#include <string.h>
+#include <algorithm>
+#include "LogFormat.h"
+
+using namespace std;
+
+/* Function Prototypes ///////////////////////////////////////////////////////*/
+
+//takes binary log stream and text output stream as arguments
+//checks the header and writes one text line per record
+//returns false if the header is missing or a record is damaged
+bool decodeLog( istream&, ostream& );
+
+/* Function Implementations //////////////////////////////////////////////////*/
+
+int main( int argc, char* argv[] )
+{
+    ifstream fin;
+    ofstream fout;
+    bool decoded;
+
+    if( argc < 2 )
+    {
+        cout << "Usage: LogDecode <binary log> [text log]" << endl;
+        return 1;
+    }
+
+    fin.open( argv[1], ios::binary );
+    if( !fin )
+    {
+        cout << "No log file found." << endl;
+        return 1;
+    }
+
+    if( argc > 2 )
+    {
+        fout.open( argv[2] );
+        decoded = decodeLog( fin, fout );
+        fout.close();
+    }
+    else
+    {
+        decoded = decodeLog( fin, cout );
+    }
+
+    fin.close();
+
+    return decoded ? 0 : 1;
+}
+
+bool decodeLog( istream& in, ostream& out )
+{
+    char magic[LOG_BINARY_MAGIC_SIZE];
+    char data[LOG_BINARY_SIZE];
+    char line[LOG_LINE_SIZE + 1];
+    LogRecord record;
+    LogDevices devices;
+    int length;
+
+    if( !in.read( magic, LOG_BINARY_MAGIC_SIZE )
+            || memcmp( magic, LOG_BINARY_MAGIC, LOG_BINARY_MAGIC_SIZE ) != 0 )
+    {
+        cout << "Not a binary simulator log." << endl;
+        return false;
+    }
+
+    if( !readLogDevices( in, devices ) )
+    {
+        cout << "Log device table is damaged." << endl;
+        return false;
+    }
+
+    while( in.read( data, LOG_BINARY_SIZE ) )
+    {
+        if( !decodeLogRecord( data, record ) )
+        {
+            cout << "Damaged log record." << endl;
+            return false;
+        }
+
+        //never trust a length to fit the line, the file may be damaged
+        length = min( formatLogRecord( record, devices, line ),
+                      LOG_LINE_SIZE );
+        line[length++] = '\n';
+        out.write( line, length );
+    }
+
+    //a run that was cut short can end part way through a record
+    if( in.gcount() != 0 )
+    {
+        cout << "Log ends part way through a record." << endl;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,456 @@
+//LogFormat.cpp
+//implements log record formatting functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_LOGFORMAT_CPP
+#define CLASS_LOGFORMAT_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <istream>
+#include "LogFormat.h"
+#include "MetaData.h"
+
+using namespace std;
+
+//the built in devices are known without a table
+LogDevices::LogDevices
+   (
+    // no parameters
+   )
+{
+    int device;
+
+    for( device = 0; device < 256; device++ )
+    {
+        present[device] = false;
+    }
+
+    name[OP_HARD_DRIVE] = "hard drive";
+    label[OP_HARD_DRIVE] = "HDD";
+    name[OP_KEYBOARD] = "keyboard";
+    name[OP_MONITOR] = "monitor";
+    name[OP_PRINTER] = "printer";
+    label[OP_PRINTER] = "PRNTR";
+}
+
+//takes a log event identifier
+//returns true if it is work done by a process on a CPU
+static bool onCore( unsigned char event )
+{
+    switch( event )
+    {
+        case LOG_OS_PREPARING:
+        case LOG_OS_STARTING:
+        case LOG_RUN_START:
+        case LOG_RUN_END:
+        case LOG_RUN_INTERRUPT:
+        case LOG_ALLOCATE_START:
+        case LOG_ALLOCATE_END:
+        case LOG_ALLOCATE_INTERRUPT:
+        case LOG_ALLOCATE_FAILED:
+        case LOG_CACHE_START:
+        case LOG_CACHE_END:
+        case LOG_CACHE_INTERRUPT:
+        case LOG_FREE_START:
+        case LOG_FREE_END:
+        case LOG_FREE_INTERRUPT:
+        case LOG_FREE_EMPTY:
+        case LOG_PAGE_FAULT:
+            return true;
+    }
+
+    return false;
+}
+
+void setLogDevice
+   (
+    LogDevices &logDevices,
+    unsigned char device,
+    const string &name,
+    const string &label
+   )
+{
+    //more than a line can show is never printed
+    logDevices.name[device] = name.substr( 0, LOG_LINE_SIZE );
+    logDevices.label[device] = label.substr( 0, LOG_LINE_SIZE );
+    logDevices.present[device] = true;
+}
+
+string encodeLogDevices
+   (
+    const LogDevices &logDevices
+   )
+{
+    string table( 2, '\0' );
+    int device, count = 0;
+
+    for( device = 0; device < 256; device++ )
+    {
+        if( logDevices.present[device] )
+        {
+            table += (char)device;
+            table += (char)logDevices.name[device].size();
+            table += logDevices.name[device];
+            table += (char)logDevices.label[device].size();
+            table += logDevices.label[device];
+            count++;
+        }
+    }
+
+    table[0] = (char)count;
+    table[1] = (char)( count >> 8 );
+
+    return table;
+}
+
+bool readLogDevices
+   (
+    istream &in,
+    LogDevices &logDevices
+   )
+{
+    unsigned char header[2], size;
+    char text[256];
+    string name;
+    int count, device;
+
+    if( !in.read( (char*)header, 2 ) )
+    {
+        return false;
+    }
+
+    for( count = header[0] | ( header[1] << 8 ); count > 0; count-- )
+    {
+        device = in.get();
+        size = in.get();
+        if( !in || size > LOG_LINE_SIZE || !in.read( text, size ) )
+        {
+            return false;
+        }
+        name.assign( text, size );
+
+        size = in.get();
+        if( !in || size > LOG_LINE_SIZE || !in.read( text, size ) )
+        {
+            return false;
+        }
+
+        setLogDevice( logDevices, device, name, string( text, size ) );
+    }
+
+    return true;
+}
+
+int formatLogRecord
+   (
+    const LogRecord &record,
+    const LogDevices &logDevices,
+    char *line
+   )
+{
+    int length, prefix;
+    const char* name;
+    const char* label;
+    const char* action;
+    const char* direction = "input";
+
+    prefix = snprintf( line, LOG_LINE_SIZE, "%.6f - ", record.time * .000001 );
+    length = prefix;
+    line += prefix;
+
+    switch( record.event )
+    {
+        case LOG_SIM_START:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Simulator program starting" );
+            break;
+        case LOG_SIM_END:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Simulator program ending" );
+            break;
+        case LOG_OS_PREPARING:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "OS: preparing process %d",
+                                record.processNum );
+            break;
+        case LOG_OS_STARTING:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "OS: starting process %d",
+                                record.processNum );
+            break;
+        case LOG_OS_ARRIVED:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "OS: process %d arrived",
+                                record.processNum );
+            break;
+        case LOG_OS_BOOST:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "OS: priorities boosted" );
+            break;
+        case LOG_OS_COMPLETED:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "OS: process %d completed",
+                                record.processNum );
+            break;
+        case LOG_RUN_START:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d start processing action",
+                                record.processNum );
+            break;
+        case LOG_RUN_END:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d end processing action",
+                                record.processNum );
+            break;
+        case LOG_RUN_INTERRUPT:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d interrupt processing action",
+                                record.processNum );
+            break;
+        case LOG_ALLOCATE_START:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d allocating memory",
+                                record.processNum );
+            break;
+        case LOG_ALLOCATE_END:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d memory allocated at 0x%08x",
+                                record.processNum, record.value );
+            break;
+        case LOG_ALLOCATE_INTERRUPT:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d interrupt memory allocation",
+                                record.processNum );
+            break;
+        case LOG_ALLOCATE_FAILED:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d memory allocation failed, "
+                                "memory full", record.processNum );
+            break;
+        case LOG_FREE_START:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d freeing memory",
+                                record.processNum );
+            break;
+        case LOG_FREE_END:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d memory freed at 0x%08x",
+                                record.processNum, record.value );
+            break;
+        case LOG_FREE_INTERRUPT:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d interrupt memory freeing",
+                                record.processNum );
+            break;
+        case LOG_FREE_EMPTY:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d has no memory to free",
+                                record.processNum );
+            break;
+        case LOG_PAGE_FAULT:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d page fault on page %u",
+                                record.processNum, record.value );
+            break;
+        case LOG_CACHE_START:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d start memory caching",
+                                record.processNum );
+            break;
+        case LOG_CACHE_END:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d end memory caching",
+                                record.processNum );
+            break;
+        case LOG_CACHE_INTERRUPT:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Process %d interrupt memory caching",
+                                record.processNum );
+            break;
+        case LOG_OUTPUT_START:
+        case LOG_OUTPUT_END:
+            direction = "output";
+            //fall through
+        case LOG_INPUT_START:
+        case LOG_INPUT_END:
+            action = ( record.event == LOG_INPUT_START
+                       || record.event == LOG_OUTPUT_START ) ? "start" : "end";
+            name = logDevices.name[record.device & 255].c_str();
+            label = logDevices.label[record.device & 255].c_str();
+            if( *name == '\0' )
+            {
+                name = "device";
+            }
+
+            if( *label == '\0' )
+            {
+                length += snprintf( line, LOG_LINE_SIZE - length,
+                                    "Process %d %s %s %s",
+                                    record.processNum, action, name,
+                                    direction );
+            }
+            else
+            {
+                length += snprintf( line, LOG_LINE_SIZE - length,
+                                    "Process %d %s %s %s on %s %u",
+                                    record.processNum, action, name,
+                                    direction, label, record.value );
+            }
+            break;
+        case LOG_CPU_STEALS:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "CPU %u: %u steals",
+                                record.device, record.value );
+            break;
+        case LOG_CPU_MIGRATIONS:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "CPU %u: %u migrations",
+                                record.device, record.value );
+            break;
+        case LOG_MEMORY_PEAK:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Memory: %u blocks in use at peak",
+                                record.value );
+            break;
+        case LOG_MEMORY_RUNS:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Memory: %u separate free runs at most",
+                                record.value );
+            break;
+        case LOG_MEMORY_FAILED:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "Memory: %u allocations failed",
+                                record.value );
+            break;
+        case LOG_TLB_HITS:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "TLB: %u hits", record.value );
+            break;
+        case LOG_TLB_MISSES:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "TLB: %u misses", record.value );
+            break;
+        case LOG_TLB_HIT_RATE: //value is in hundredths of a percent
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "TLB: %u.%02u%% hit rate",
+                                record.value / 100, record.value % 100 );
+            break;
+        case LOG_PAGE_FAULTS:
+            length += snprintf( line, LOG_LINE_SIZE - length,
+                                "TLB: %u page faults", record.value );
+            break;
+        case LOG_DISK_REQUESTS:
+        case LOG_DISK_SEEK:
+        case LOG_DISK_WAIT:
+            label = logDevices.label[OP_HARD_DRIVE].c_str();
+            if( *label == '\0' )
+            {
+                label = "Hard drive";
+            }
+
+            if( record.event == LOG_DISK_REQUESTS )
+            {
+                length += snprintf( line, LOG_LINE_SIZE - length,
+                                    "%s %u: %u requests", label,
+                                    record.device, record.value );
+            }
+            else if( record.event == LOG_DISK_SEEK ) //hundredths of a track
+            {
+                length += snprintf( line, LOG_LINE_SIZE - length,
+                                    "%s %u: %u.%02u tracks average seek",
+                                    label, record.device, record.value / 100,
+                                    record.value % 100 );
+            }
+            else //usec
+            {
+                length += snprintf( line, LOG_LINE_SIZE - length,
+                                    "%s %u: %u.%06u sec average queue wait",
+                                    label, record.device,
+                                    record.value / 1000000,
+                                    record.value % 1000000 );
+            }
+            break;
+    }
+
+    //snprintf counts what didn't fit, a long device name or label is cut
+    //  off at the end of the line
+    length = min( length, LOG_LINE_SIZE - 1 );
+
+    //work done on a simulated CPU names the core
+    if( record.core > 0 && onCore( record.event ) )
+    {
+        length += snprintf( line + length - prefix, LOG_LINE_SIZE - length,
+                            " on CPU %d", record.core - 1 );
+        length = min( length, LOG_LINE_SIZE - 1 );
+    }
+
+    return length;
+}
+
+int encodeLogRecord
+   (
+    const LogRecord &record,
+    char *data
+   )
+{
+    unsigned long time = record.time;
+    unsigned int processNum = record.processNum;
+    int index;
+
+    //little endian whatever the host order
+    for( index = 0; index < 8; index++ )
+    {
+        data[index] = (char)( time >> ( 8 * index ) );
+    }
+    for( index = 0; index < 4; index++ )
+    {
+        data[8 + index] = (char)( processNum >> ( 8 * index ) );
+        data[12 + index] = (char)( record.value >> ( 8 * index ) );
+    }
+    data[16] = (char)record.device;
+    data[17] = (char)record.event;
+    data[18] = (char)record.core;
+
+    return LOG_BINARY_SIZE;
+}
+
+bool decodeLogRecord
+   (
+    const char *data,
+    LogRecord &record
+   )
+{
+    const unsigned char *bytes = (const unsigned char*)data;
+    unsigned long time = 0;
+    unsigned int processNum = 0, value = 0;
+    int index;
+
+    for( index = 7; index >= 0; index-- )
+    {
+        time = ( time << 8 ) | bytes[index];
+    }
+    for( index = 3; index >= 0; index-- )
+    {
+        processNum = ( processNum << 8 ) | bytes[8 + index];
+        value = ( value << 8 ) | bytes[12 + index];
+    }
+
+    record.time = (long)time;
+    record.seq = 0;
+    record.processNum = (int)processNum;
+    record.value = value;
+    record.device = bytes[16];
+    record.event = bytes[17];
+    record.core = bytes[18];
+
+    return record.event < LOG_EVENT_COUNT;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_LOGFORMAT_CPP
@@ -0,0 +1,150 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file LogFormat.h
+ *
+ * @brief Definition file for log records and their text and binary forms
+ *
+ * @details Specifies the record kept for every log line and the two ways it
+ *          is written out. The text form is the familiar
+ *          "seconds - message" line. The binary form stores the fields as
+ *          fixed width little endian integers after an eight byte file
+ *          header and the table of device names, and is turned back into
+ *          text by the LogDecode tool.
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_LOGFORMAT_H
+#define CLASS_LOGFORMAT_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <string>
+#include <istream>
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//log event identifiers
+static const unsigned char LOG_SIM_START = 0,
+                           LOG_SIM_END = 1,
+                           LOG_OS_PREPARING = 2,
+                           LOG_OS_STARTING = 3,
+                           LOG_OS_COMPLETED = 4,
+                           LOG_RUN_START = 5,
+                           LOG_RUN_END = 6,
+                           LOG_RUN_INTERRUPT = 7,
+                           LOG_ALLOCATE_START = 8,
+                           LOG_ALLOCATE_END = 9,
+                           LOG_ALLOCATE_INTERRUPT = 10,
+                           LOG_CACHE_START = 11,
+                           LOG_CACHE_END = 12,
+                           LOG_CACHE_INTERRUPT = 13,
+                           LOG_INPUT_START = 14,
+                           LOG_INPUT_END = 15,
+                           LOG_OUTPUT_START = 16,
+                           LOG_OUTPUT_END = 17,
+                           LOG_CPU_STEALS = 18,
+                           LOG_CPU_MIGRATIONS = 19,
+                           LOG_ALLOCATE_FAILED = 20,
+                           LOG_FREE_START = 21,
+                           LOG_FREE_END = 22,
+                           LOG_FREE_INTERRUPT = 23,
+                           LOG_FREE_EMPTY = 24,
+                           LOG_MEMORY_PEAK = 25,
+                           LOG_MEMORY_RUNS = 26,
+                           LOG_MEMORY_FAILED = 27,
+                           LOG_PAGE_FAULT = 28,
+                           LOG_TLB_HITS = 29,
+                           LOG_TLB_MISSES = 30,
+                           LOG_TLB_HIT_RATE = 31,
+                           LOG_PAGE_FAULTS = 32,
+                           LOG_DISK_REQUESTS = 33,
+                           LOG_DISK_SEEK = 34,
+                           LOG_DISK_WAIT = 35,
+                           LOG_OS_ARRIVED = 36,
+                           LOG_OS_BOOST = 37,
+                           LOG_EVENT_COUNT = 38;
+
+//longest formatted log line
+static const int LOG_LINE_SIZE = 128;
+
+//first bytes of a binary log file
+static const char LOG_BINARY_MAGIC[] = "SIMLOG3\n";
+static const int LOG_BINARY_MAGIC_SIZE = 8;
+
+//bytes in one binary record: time 8, process 4, value 4, device 1, event 1,
+//  core 1
+static const int LOG_BINARY_SIZE = 19;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//one log line in binary form
+struct LogRecord
+{
+    long time; //microseconds of simulation time
+    unsigned int seq; //global order the records were written in
+    int processNum;
+    unsigned int value; //device unit, memory address, page or summary count
+    unsigned short device; //OP_ identifier of the I/O device, or the CPU
+                           //  or hard drive of a summary line
+    unsigned char event; //LOG_ identifier
+    unsigned char core; //1 + the simulated CPU that ran it, 0 for none
+};
+
+//how log lines name each I/O device, one table per log
+//the built in devices are known without setting them
+struct LogDevices
+{
+    string name[256];
+    string label[256];
+    bool present[256]; //set by setLogDevice()
+
+    LogDevices();
+};
+
+// Function prototypes ////////////////////////////////////////////////////////
+
+//takes a device table, a device operation identifier, its name and unit
+//  label
+//sets how log lines name the device, an empty label leaves out the unit
+//set before any line naming the device is formatted
+//a name or label is cut to LOG_LINE_SIZE chars
+void setLogDevice( LogDevices &logDevices, unsigned char device,
+                   const string &name, const string &label );
+
+//returns every device set by setLogDevice() in binary form, written after
+//  the magic: a two byte count, then for each the identifier, the name
+//  length and name, and the label length and label
+string encodeLogDevices( const LogDevices &logDevices );
+
+//takes a binary log positioned after the magic and a table to fill
+//reads the device table and sets each device
+//returns false if the table is cut short or holds a name or label longer
+//  than LOG_LINE_SIZE
+bool readLogDevices( istream &in, LogDevices &logDevices );
+
+//takes a record, the device table of its log and a buffer of at least
+//  LOG_LINE_SIZE chars
+//formats the record as one text log line without the newline
+//actions run on a simulated CPU name it when core is set
+//returns the length of the line, at most LOG_LINE_SIZE - 1, a line that
+//  doesn't fit is cut off
+int formatLogRecord( const LogRecord &record, const LogDevices &logDevices,
+                     char *line );
+
+//takes a record and a buffer of at least LOG_BINARY_SIZE bytes
+//stores the record in binary form, the sequence number is not kept
+//returns LOG_BINARY_SIZE
+int encodeLogRecord( const LogRecord &record, char *data );
+
+//takes LOG_BINARY_SIZE bytes of a binary log and a record to fill
+//returns false if the event identifier is not valid
+bool decodeLogRecord( const char *data, LogRecord &record );
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_LOGFORMAT_H
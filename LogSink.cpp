@@ -0,0 +1,248 @@
+//LogSink.cpp
+//implements LogSink functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_LOGSINK_CPP
+#define CLASS_LOGSINK_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include "LogSink.h"
+
+using namespace std;
+
+LogSink::LogSink
+   (
+    // no parameters
+   )
+       : monitorFd( -1 ), fileFd( -1 ), buffer( NULL ), head( 0 ), tail( 0 ),
+         closing( false ), running( false )
+{
+    pthread_mutex_init( &mutex, NULL );
+    pthread_cond_init( &dataReady, NULL );
+    pthread_cond_init( &spaceFree, NULL );
+}
+
+LogSink::~LogSink
+   (
+    // no parameters
+   )
+{
+    close();
+    pthread_mutex_destroy( &mutex );
+    pthread_cond_destroy( &dataReady );
+    pthread_cond_destroy( &spaceFree );
+}
+
+bool LogSink::open
+   (
+    bool toMonitor,
+    const string &filePath
+   )
+{
+    if( !filePath.empty() )
+    {
+        fileFd = ::open( filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+        if( fileFd < 0 )
+        {
+            return false;
+        }
+    }
+
+    monitorFd = toMonitor ? STDOUT_FILENO : -1;
+    buffer = new char[BUFFER_SIZE];
+    head = tail = 0;
+    closing = false;
+
+    running = true;
+    pthread_create( &flusher, NULL, flusherMain, (void*)this );
+
+    return true;
+}
+
+void LogSink::write
+   (
+    const char *text,
+    unsigned int length
+   )
+{
+    unsigned int offset, count;
+    bool wasEmpty;
+
+    pthread_mutex_lock( &mutex );
+    wasEmpty = ( tail == head );
+    while( length > 0 )
+    {
+        while( tail - head == BUFFER_SIZE )
+        {
+            pthread_cond_signal( &dataReady );
+            pthread_cond_wait( &spaceFree, &mutex );
+        }
+
+        //copy up to the end of the free space or of the buffer
+        offset = tail & ( BUFFER_SIZE - 1 );
+        count = BUFFER_SIZE - ( tail - head );
+        if( count > BUFFER_SIZE - offset )
+        {
+            count = BUFFER_SIZE - offset;
+        }
+        if( count > length )
+        {
+            count = length;
+        }
+
+        memcpy( buffer + offset, text, count );
+        tail += count;
+        text += count;
+        length -= count;
+    }
+
+    //an empty buffer starts the flush timer, half full flushes now
+    if( wasEmpty || tail - head >= BUFFER_SIZE / 2 )
+    {
+        pthread_cond_signal( &dataReady );
+    }
+    pthread_mutex_unlock( &mutex );
+}
+
+void LogSink::write
+   (
+    const string &text
+   )
+{
+    write( text.data(), text.size() );
+}
+
+void LogSink::close
+   (
+    // no parameters
+   )
+{
+    if( running )
+    {
+        pthread_mutex_lock( &mutex );
+        closing = true;
+        pthread_cond_signal( &dataReady );
+        pthread_mutex_unlock( &mutex );
+
+        pthread_join( flusher, NULL );
+        running = false;
+
+        if( fileFd >= 0 )
+        {
+            ::close( fileFd );
+            fileFd = -1;
+        }
+
+        delete [] buffer;
+        buffer = NULL;
+    }
+}
+
+void* LogSink::flusherMain
+   (
+    void* arg
+   )
+{
+    ((LogSink*)arg)->flush();
+
+    return NULL;
+}
+
+void LogSink::flush
+   (
+    // no parameters
+   )
+{
+    unsigned int start, end, offset, count;
+    struct timespec deadline;
+
+    pthread_mutex_lock( &mutex );
+    while( true )
+    {
+        while( tail == head && !closing )
+        {
+            pthread_cond_wait( &dataReady, &mutex );
+        }
+
+        if( tail == head ) //closing with nothing left
+        {
+            break;
+        }
+
+        //give a small amount of text time to grow before writing it
+        if( tail - head < BUFFER_SIZE / 2 && !closing )
+        {
+            clock_gettime( CLOCK_REALTIME, &deadline );
+            deadline.tv_nsec += FLUSH_INTERVAL * 1000000L;
+            deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+            deadline.tv_nsec %= 1000000000L;
+            pthread_cond_timedwait( &dataReady, &mutex, &deadline );
+        }
+
+        start = head;
+        end = tail;
+        pthread_mutex_unlock( &mutex );
+
+        //the writer only fills outside [start, end), so this needs no lock
+        while( start != end )
+        {
+            offset = start & ( BUFFER_SIZE - 1 );
+            count = end - start;
+            if( count > BUFFER_SIZE - offset )
+            {
+                count = BUFFER_SIZE - offset;
+            }
+
+            writeAll( monitorFd, buffer + offset, count );
+            writeAll( fileFd, buffer + offset, count );
+            start += count;
+        }
+
+        pthread_mutex_lock( &mutex );
+        head = end;
+        pthread_cond_signal( &spaceFree );
+    }
+    pthread_mutex_unlock( &mutex );
+}
+
+void LogSink::writeAll
+   (
+    int fd,
+    const char *text,
+    unsigned int length
+   )
+{
+    ssize_t written;
+
+    if( fd < 0 )
+    {
+        return;
+    }
+
+    while( length > 0 )
+    {
+        written = ::write( fd, text, length );
+        if( written < 0 )
+        {
+            if( errno == EINTR )
+            {
+                continue;
+            }
+            return; //nowhere left to report it
+        }
+
+        text += written;
+        length -= written;
+    }
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_LOGSINK_CPP
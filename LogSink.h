@@ -0,0 +1,92 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file LogSink.h
+ *
+ * @brief Definition file for LogSink class
+ *
+ * @details Specifies the destination of the simulator log. Text is copied
+ *          into a fixed size buffer and a background flusher writes it to
+ *          the monitor, the log file or both. The flusher writes as soon as
+ *          half the buffer is used, and at least every FLUSH_INTERVAL
+ *          otherwise, so memory use does not grow with the length of the
+ *          run and a crashed run still leaves everything up to its last
+ *          flush in the log. A writer that finds the buffer full waits for
+ *          the flusher.
+ *
+ * @Note write() is meant for one writer thread at a time
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_LOGSINK_H
+#define CLASS_LOGSINK_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <string>
+
+using namespace std;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class LogSink
+   {
+    public:
+
+    // bytes held before the writer has to wait, must be a power of two
+    static const unsigned int BUFFER_SIZE = 65536;
+
+    // longest time text waits in the buffer, in milliseconds
+    static const int FLUSH_INTERVAL = 100;
+
+    // constructors
+    LogSink();
+
+    // destructor
+    ~LogSink();
+
+    // modifiers
+
+       // starts the flusher, writing to the monitor and/or the named file
+       // an empty file path means no file
+       // returns false if the file can't be created
+       bool open( bool toMonitor, const string &filePath );
+
+       // copies text into the buffer, waiting while it is full
+       void write( const char *text, unsigned int length );
+       void write( const string &text );
+
+       // writes everything still buffered and stops the flusher
+       void close();
+
+    private:
+
+       // flusher thread entry point, arg is the sink
+       static void* flusherMain( void* arg );
+
+       // writes buffered text until the sink is closed
+       void flush();
+
+       // writes all of a span to one descriptor
+       static void writeAll( int fd, const char *text, unsigned int length );
+
+       int monitorFd; //-1 when not logging to the monitor
+       int fileFd; //-1 when not logging to a file
+       char *buffer;
+       unsigned int head; //next byte to flush, free running
+       unsigned int tail; //next byte to fill, free running
+       pthread_mutex_t mutex;
+       pthread_cond_t dataReady;
+       pthread_cond_t spaceFree;
+       bool closing;
+       pthread_t flusher;
+       bool running;
+
+       LogSink( const LogSink &copiedSink );
+       const LogSink &operator = ( const LogSink &rhSink );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_LOGSINK_H
@@ -0,0 +1,246 @@
+//MemoryManager.cpp
+//implements MemoryManager functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_MEMORYMANAGER_CPP
+#define CLASS_MEMORYMANAGER_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "MemoryManager.h"
+
+using namespace std;
+
+MemoryManager::MemoryManager
+   (
+    // no parameters
+   )
+       : blockSize( 0 ), blockCount( 0 ), usedBlocks( 0 ), peakUsed( 0 ),
+         freeRuns( 0 ), peakFreeRuns( 0 ), failed( 0 )
+{
+	// initializers used
+}
+
+void MemoryManager::init
+   (
+    long totalMemory,
+    int size
+   )
+{
+    long count, words, word;
+
+    blockSize = size;
+    blockCount = size > 0 ? totalMemory / size : 0;
+    usedBlocks = peakUsed = failed = 0;
+    freeRuns = peakFreeRuns = ( blockCount > 0 ) ? 1 : 0;
+
+    //every block starts free, each level summarizes the one below
+    levels.clear();
+    count = blockCount;
+    do
+    {
+        words = max( 1L, ( count + 63 ) / 64 );
+        levels.push_back( vector<unsigned long long>( words, 0 ) );
+        for( word = 0; word < count / 64; word++ )
+        {
+            levels.back()[word] = ~0ULL;
+        }
+        if( count % 64 != 0 )
+        {
+            levels.back()[count / 64] = ( 1ULL << ( count % 64 ) ) - 1;
+        }
+        count = words;
+    }
+    while( words > 1 );
+}
+
+bool MemoryManager::allocate
+   (
+    unsigned int &address
+   )
+{
+    long block = 0;
+    int level;
+
+    if( levels.back()[0] == 0 )
+    {
+        failed++;
+        return false;
+    }
+
+    //follow the lowest set bit down from the top
+    for( level = levels.size() - 1; level >= 0; level-- )
+    {
+        block = block * 64 + __builtin_ctzll( levels[level][block] );
+    }
+
+    //a run splits in two or shrinks, or a single block run goes away
+    if( isFree( block - 1 ) && isFree( block + 1 ) )
+    {
+        freeRuns++;
+    }
+    else if( !isFree( block - 1 ) && !isFree( block + 1 ) )
+    {
+        freeRuns--;
+    }
+    if( freeRuns > peakFreeRuns )
+    {
+        peakFreeRuns = freeRuns;
+    }
+
+    markUsed( block );
+    usedBlocks++;
+    if( usedBlocks > peakUsed )
+    {
+        peakUsed = usedBlocks;
+    }
+
+    address = block * blockSize;
+
+    return true;
+}
+
+bool MemoryManager::release
+   (
+    unsigned int address
+   )
+{
+    long block;
+
+    if( blockSize <= 0 || address % blockSize != 0 )
+    {
+        return false;
+    }
+
+    block = address / blockSize;
+    if( block >= blockCount || isFree( block ) )
+    {
+        return false;
+    }
+
+    //two runs join, a run grows, or a new single block run appears
+    if( isFree( block - 1 ) && isFree( block + 1 ) )
+    {
+        freeRuns--;
+    }
+    else if( !isFree( block - 1 ) && !isFree( block + 1 ) )
+    {
+        freeRuns++;
+        if( freeRuns > peakFreeRuns )
+        {
+            peakFreeRuns = freeRuns;
+        }
+    }
+
+    markFree( block );
+    usedBlocks--;
+
+    return true;
+}
+
+long MemoryManager::getBlockCount
+   (
+    // no parameters
+   ) const
+{
+    return blockCount;
+}
+
+long MemoryManager::getUsedBlocks
+   (
+    // no parameters
+   ) const
+{
+    return usedBlocks;
+}
+
+long MemoryManager::getPeakUsed
+   (
+    // no parameters
+   ) const
+{
+    return peakUsed;
+}
+
+long MemoryManager::getFreeRuns
+   (
+    // no parameters
+   ) const
+{
+    return freeRuns;
+}
+
+long MemoryManager::getPeakFreeRuns
+   (
+    // no parameters
+   ) const
+{
+    return peakFreeRuns;
+}
+
+long MemoryManager::getFailed
+   (
+    // no parameters
+   ) const
+{
+    return failed;
+}
+
+bool MemoryManager::isFree
+   (
+    long block
+   ) const
+{
+    if( block < 0 || block >= blockCount )
+    {
+        return false;
+    }
+
+    return ( levels[0][block / 64] >> ( block % 64 ) ) & 1;
+}
+
+void MemoryManager::markFree
+   (
+    long block
+   )
+{
+    unsigned int level;
+    bool wasEmpty;
+
+    //a word that was empty now has a free bit, so its summary bit is set
+    for( level = 0; level < levels.size(); level++ )
+    {
+        wasEmpty = ( levels[level][block / 64] == 0 );
+        levels[level][block / 64] |= 1ULL << ( block % 64 );
+        if( !wasEmpty )
+        {
+            break;
+        }
+        block /= 64;
+    }
+}
+
+void MemoryManager::markUsed
+   (
+    long block
+   )
+{
+    unsigned int level;
+
+    //a word with no free bits left clears its summary bit
+    for( level = 0; level < levels.size(); level++ )
+    {
+        levels[level][block / 64] &= ~( 1ULL << ( block % 64 ) );
+        if( levels[level][block / 64] != 0 )
+        {
+            break;
+        }
+        block /= 64;
+    }
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_MEMORYMANAGER_CPP
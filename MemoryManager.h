@@ -0,0 +1,92 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file MemoryManager.h
+ *
+ * @brief Definition file for MemoryManager class
+ *
+ * @details Specifies the simulated physical memory. System memory is split
+ *          into blocks of the configured block size and every allocation
+ *          takes one block, the lowest free one. Free blocks are kept in a
+ *          bitmap with a summary bitmap above it, one bit per word below,
+ *          repeated until one word is left, so allocate and free touch one
+ *          word per level. The number of separate free runs is kept as
+ *          blocks change hands to show how fragmented memory gets.
+ *          Addresses are in kbytes, like the configured sizes.
+ *
+ * @Note Not locked, the caller guards it. Which process owns a block is
+ *       kept by the process, the manager only knows used from free.
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_MEMORYMANAGER_H
+#define CLASS_MEMORYMANAGER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+
+using namespace std;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class MemoryManager
+   {
+    public:
+
+    // constructors
+    MemoryManager();
+
+    // modifiers
+
+       // frees all memory, sized in kbytes
+       void init( long totalMemory, int size );
+
+       // takes the lowest free block
+       // returns false if memory is full
+       bool allocate( unsigned int &address );
+
+       // frees the block at an address
+       // returns false if it is not an allocated block
+       bool release( unsigned int address );
+
+    // accessors
+
+       long getBlockCount() const;
+
+       long getUsedBlocks() const;
+
+       // most blocks in use at once
+       long getPeakUsed() const;
+
+       // separate runs of free blocks now and at most
+       long getFreeRuns() const;
+       long getPeakFreeRuns() const;
+
+       // allocations refused because memory was full
+       long getFailed() const;
+
+    private:
+
+       // whether a block is free, blocks out of range are not
+       bool isFree( long block ) const;
+
+       // sets or clears the bit of a block, keeping the summaries
+       void markFree( long block );
+       void markUsed( long block );
+
+       //levels[0] has a bit per block set while it is free, each level
+       //  above has a bit per word of the one below set while it is not 0
+       vector< vector<unsigned long long> > levels;
+       int blockSize;
+       long blockCount;
+       long usedBlocks;
+       long peakUsed;
+       long freeRuns;
+       long peakFreeRuns;
+       long failed;
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_MEMORYMANAGER_H
@@ -0,0 +1,314 @@
+//MetaData.cpp
+//implements MetaDataParser and metadata parsing functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_METADATA_CPP
+#define CLASS_METADATA_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <charconv>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MetaData.h"
+#include "DeviceRegistry.h"
+
+using namespace std;
+
+//text that comes right before the first entry
+static const string_view START_HEADER = "Code:";
+
+//whitespace between entries, cheaper than the locale aware isspace()
+static inline bool isBlank( char c )
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+MetaDataParser::MetaDataParser
+   (
+    // no parameters
+   )
+       : devices( NULL ), fileData( NULL ), fileSize( 0 ), position( NULL ),
+         end( NULL )
+{
+	// initializers used
+}
+
+MetaDataParser::~MetaDataParser
+   (
+    // no parameters
+   )
+{
+    close();
+}
+
+bool MetaDataParser::open
+   (
+    const string &path,
+    const DeviceRegistry &deviceTypes
+   )
+{
+    struct stat fileStat;
+    int fd;
+    void* mapped;
+    string_view contents;
+    size_t header;
+
+    close();
+    devices = &deviceTypes;
+
+    fd = ::open( path.c_str(), O_RDONLY );
+    if( fd < 0 )
+    {
+        return false;
+    }
+
+    if( fstat( fd, &fileStat ) < 0 || fileStat.st_size == 0 )
+    {
+        ::close( fd );
+        return false;
+    }
+
+    mapped = mmap( NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd ); //mapping stays valid
+    if( mapped == MAP_FAILED )
+    {
+        return false;
+    }
+
+    madvise( mapped, fileStat.st_size, MADV_SEQUENTIAL );
+
+    fileData = (const char*)mapped;
+    fileSize = fileStat.st_size;
+    end = fileData + fileSize;
+
+    contents = string_view( fileData, fileSize );
+    header = contents.find( START_HEADER );
+    if( header == string_view::npos )
+    {
+        close();
+        return false;
+    }
+
+    position = fileData + header + START_HEADER.size();
+    return true;
+}
+
+void MetaDataParser::close
+   (
+    // no parameters
+   )
+{
+    if( fileData != NULL )
+    {
+        munmap( (void*)fileData, fileSize );
+    }
+
+    fileData = NULL;
+    fileSize = 0;
+    position = NULL;
+    end = NULL;
+    entryText = string_view();
+}
+
+int MetaDataParser::next
+   (
+    MetaDataType &entry
+   )
+{
+    const char *first, *last;
+    unsigned char operation;
+    int cycles, at;
+
+    do
+    {
+        //skip whitespace before the entry
+        while( position < end && isBlank( *position ) )
+        {
+            position++;
+        }
+
+        if( position >= end )
+        {
+            return PARSE_END;
+        }
+
+        //entries end with ';', the last one with '.'
+        first = position;
+        while( position < end && *position != ';' && *position != '.' )
+        {
+            position++;
+        }
+
+        last = position;
+        if( position < end && *position == ';' )
+        {
+            position++;
+        }
+        else
+        {
+            position = end; //nothing is read after the last entry
+        }
+
+        while( last > first && isBlank( *( last - 1 ) ) )
+        {
+            last--;
+        }
+
+        entryText = string_view( first, last - first );
+    } while( entryText.empty() );
+
+    if( entryText.size() < 4 || entryText[1] != '(' )
+    {
+        return PARSE_ERROR;
+    }
+
+    operation = parseOperation( entryText[0], parseData( entryText ),
+                                *devices );
+    if( operation == OP_UNKNOWN || !parseCycles( entryText, cycles )
+            || !parseAt( entryText, at ) )
+    {
+        return PARSE_ERROR;
+    }
+
+    entry.code = entryText[0];
+    entry.operation = operation;
+    entry.cycles = cycles;
+    entry.at = at;
+    entry.started = false;
+
+    return PARSE_ENTRY;
+}
+
+string_view MetaDataParser::getEntryText
+   (
+    // no parameters
+   ) const
+{
+    return entryText;
+}
+
+int MetaDataParser::getEntryLine
+   (
+    // no parameters
+   ) const
+{
+    //only needed for error messages, so lines are not tracked while parsing
+    if( entryText.data() == NULL )
+    {
+        return 0;
+    }
+
+    return 1 + count( fileData, entryText.data(), '\n' );
+}
+
+string_view parseData( string_view in )
+{
+    size_t open = in.find( '(' ), close;
+
+    if( open == string_view::npos )
+    {
+        return string_view();
+    }
+
+    close = in.find( ')', open + 1 );
+    if( close == string_view::npos )
+    {
+        return string_view();
+    }
+
+    return in.substr( open + 1, close - open - 1 );
+}
+
+unsigned char parseOperation( char code, string_view descriptor,
+                              const DeviceRegistry &devices )
+{
+    switch( code )
+    {
+        case 'S': //Operating System
+        case 'A': //Program Application
+            if( descriptor == "start" )
+            {
+                return OP_START;
+            }
+            if( descriptor == "end" )
+            {
+                return OP_END;
+            }
+            break;
+
+        case 'P': //Process
+            if( descriptor == "run" )
+            {
+                return OP_RUN;
+            }
+            break;
+
+        case 'M': //Memory
+            if( descriptor == "allocate" )
+            {
+                return OP_ALLOCATE;
+            }
+            if( descriptor == "cache" )
+            {
+                return OP_CACHE;
+            }
+            if( descriptor == "free" )
+            {
+                return OP_FREE;
+            }
+            break;
+
+        case 'I': //Input
+        case 'O': //Output
+            return devices.find( code, descriptor );
+    }
+
+    return OP_UNKNOWN;
+}
+
+bool parseCycles( string_view in, int &cycles )
+{
+    size_t close = in.find( ')' );
+    const char *first, *last;
+    from_chars_result result;
+
+    if( close == string_view::npos || close + 1 >= in.size() )
+    {
+        return false;
+    }
+
+    first = in.data() + close + 1;
+    last = in.data() + min( in.find( '@', close ), in.size() );
+    result = from_chars( first, last, cycles );
+
+    return result.ec == errc() && result.ptr == last && cycles >= 0;
+}
+
+bool parseAt( string_view in, int &at )
+{
+    size_t sign = in.find( '@', in.find( ')' ) );
+    const char *first, *last;
+    from_chars_result result;
+
+    at = -1;
+    if( sign == string_view::npos )
+    {
+        return true;
+    }
+
+    first = in.data() + sign + 1;
+    last = in.data() + in.size();
+    result = from_chars( first, last, at );
+
+    return result.ec == errc() && result.ptr == last && at >= 0
+           && first != last;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_METADATA_CPP
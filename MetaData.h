@@ -0,0 +1,137 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file MetaData.h
+ *
+ * @brief Definition file for metadata entries and the MetaDataParser class
+ *
+ * @details Specifies the metadata entry structure and a parser that maps the
+ *          metadata file into memory and tokenizes code(descriptor)cycles
+ *          entries in a single pass. Entries are read as spans of the mapped
+ *          file, only the fields of each entry are copied out. The
+ *          descriptor is resolved to an operation identifier while parsing
+ *          so the simulator never compares descriptor strings. I/O
+ *          descriptors are looked up in the DeviceRegistry.
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_METADATA_H
+#define CLASS_METADATA_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+class DeviceRegistry;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//MetaDataParser::next() results
+static const int PARSE_ENTRY = 0,
+                 PARSE_ERROR = 1,
+                 PARSE_END = 2;
+
+//operation identifiers, resolved from the descriptor
+static const unsigned char OP_START = 0,
+                           OP_END = 1,
+                           OP_RUN = 2,
+                           OP_ALLOCATE = 3,
+                           OP_CACHE = 4,
+                           OP_HARD_DRIVE = 5,
+                           OP_KEYBOARD = 6,
+                           OP_MONITOR = 7,
+                           OP_PRINTER = 8,
+                           OP_FREE = 9,
+                           OP_UNKNOWN = 10;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//holds one metadata object
+//plain data, copying one never allocates
+struct MetaDataType
+{
+    int cycles;
+    int at; //number after '@', the track of an I/O entry or the arrival
+            //  msec of A(start), -1 if none
+    char code;
+    unsigned char operation; //OP_START, OP_RUN, ... from the descriptor
+    bool started;
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class MetaDataParser
+   {
+    public:
+
+    // constructors
+    MetaDataParser();
+
+    // destructor
+    ~MetaDataParser();
+
+    // modifiers
+
+       // maps the metadata file and moves past the start header
+       // I/O entries must name a device of the registry
+       // returns false if the file can't be opened or has no header
+       bool open( const string &path, const DeviceRegistry &deviceTypes );
+
+       // unmaps the file
+       void close();
+
+       // reads the next entry into the given object
+       // returns PARSE_ENTRY, PARSE_ERROR for a malformed entry that was
+       //   skipped, or PARSE_END after the last entry
+       int next( MetaDataType &entry );
+
+    // accessors
+
+       // text and line number of the entry last returned by next()
+       string_view getEntryText() const;
+       int getEntryLine() const;
+
+    private:
+
+       const DeviceRegistry *devices;
+       const char *fileData;
+       size_t fileSize;
+       const char *position; //start of the next entry
+       const char *end;
+       string_view entryText;
+
+       MetaDataParser( const MetaDataParser &copiedParser );
+       const MetaDataParser &operator = ( const MetaDataParser &rhParser );
+   };
+
+// Function prototypes ////////////////////////////////////////////////////////
+
+//takes as input one metadata object as a span
+//returns the descriptor between the parentheses, empty if there are none
+string_view parseData( string_view in );
+
+//takes as input a metadata code, descriptor and the known devices
+//returns the matching operation identifier, OP_UNKNOWN if the descriptor
+//  is not valid for the code
+unsigned char parseOperation( char code, string_view descriptor,
+                              const DeviceRegistry &devices );
+
+//takes as input one metadata object as a span and an int to hold the result
+//parses the cycle count after the descriptor
+//returns false if it is missing or not a whole number
+bool parseCycles( string_view in, int &cycles );
+
+//takes as input one metadata object as a span and an int to hold the result
+//parses the number after an '@' following the cycle count, -1 if there is
+//  no '@'
+//returns false if it is not a whole number
+bool parseAt( string_view in, int &at );
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_METADATA_H
@@ -0,0 +1,179 @@
+//RunQueues.cpp
+//implements RunQueues functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_RUNQUEUES_CPP
+#define CLASS_RUNQUEUES_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "RunQueues.h"
+
+using namespace std;
+
+RunQueues::RunQueues
+   (
+    // no parameters
+   )
+       : queues( NULL ), coreCount( 0 ), readyCount( 0 )
+{
+	// initializers used
+}
+
+RunQueues::~RunQueues
+   (
+    // no parameters
+   )
+{
+    delete [] queues;
+}
+
+void RunQueues::init
+   (
+    int algorithmId,
+    int processCount,
+    int cores,
+    int levelCount
+   )
+{
+    int core;
+
+    delete [] queues;
+    queues = new Scheduler[cores];
+    coreCount = cores;
+    readyCount = 0;
+
+    for( core = 0; core < coreCount; core++ )
+    {
+        queues[core].init( algorithmId, levelCount );
+    }
+
+    lastCore.assign( processCount, -1 );
+    steals.assign( coreCount, 0 );
+    migrations.assign( coreCount, 0 );
+}
+
+void RunQueues::add
+   (
+    int core,
+    int index,
+    int order,
+    int level
+   )
+{
+    queues[core].add( index, order, level );
+    readyCount++;
+}
+
+int RunQueues::take
+   (
+    int core,
+    bool &migrated
+   )
+{
+    int from = core, index;
+
+    migrated = false;
+    if( queues[core].isEmpty() )
+    {
+        from = victim( core );
+        if( from < 0 )
+        {
+            return -1;
+        }
+
+        steals[core]++;
+    }
+
+    index = queues[from].take();
+    readyCount--;
+
+    if( lastCore[index] >= 0 && lastCore[index] != core )
+    {
+        migrated = true;
+        migrations[core]++;
+    }
+    lastCore[index] = core;
+
+    return index;
+}
+
+void RunQueues::boost
+   (
+    // no parameters
+   )
+{
+    int core;
+
+    for( core = 0; core < coreCount; core++ )
+    {
+        queues[core].boost();
+    }
+}
+
+bool RunQueues::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    return readyCount == 0;
+}
+
+int RunQueues::getCoreCount
+   (
+    // no parameters
+   ) const
+{
+    return coreCount;
+}
+
+int RunQueues::getSteals
+   (
+    int core
+   ) const
+{
+    return steals[core];
+}
+
+int RunQueues::getMigrations
+   (
+    int core
+   ) const
+{
+    return migrations[core];
+}
+
+int RunQueues::getNextKey
+   (
+    int core
+   ) const
+{
+    return queues[core].getNextKey();
+}
+
+int RunQueues::victim
+   (
+    int core
+   ) const
+{
+    int other, size, best = -1, bestSize = 0;
+
+    //look at the cores after this one first so steals spread out
+    for( other = ( core + 1 ) % coreCount; other != core;
+         other = ( other + 1 ) % coreCount )
+    {
+        size = queues[other].getSize();
+        if( size > bestSize )
+        {
+            best = other;
+            bestSize = size;
+        }
+    }
+
+    return best;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_RUNQUEUES_CPP
@@ -0,0 +1,95 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file RunQueues.h
+ *
+ * @brief Definition file for RunQueues class
+ *
+ * @details Specifies the ready processes of every simulated CPU. Each CPU
+ *          has its own Scheduler, so a process put back after its quantum
+ *          waits on the CPU that last ran it and keeps its cache. A CPU
+ *          with nothing of its own steals the next process of the CPU with
+ *          the most waiting. A process that then runs on a different CPU
+ *          than before has migrated. Steals and migrations are counted for
+ *          the CPU that took the process.
+ *
+ * @Note Not locked, the caller guards it
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_RUNQUEUES_H
+#define CLASS_RUNQUEUES_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "Scheduler.h"
+
+using namespace std;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class RunQueues
+   {
+    public:
+
+    // constructors
+    RunQueues();
+
+    // destructor
+    ~RunQueues();
+
+    // modifiers
+
+       // empties every queue, one per core, each using the algorithm with
+       //   levelCount MLFQ levels
+       void init( int algorithmId, int processCount, int cores,
+                  int levelCount );
+
+       // adds a ready process to the queue of a core, SJF and SRTF take
+       //   the lowest order first, MLFQ uses the level
+       void add( int core, int index, int order, int level );
+
+       // takes out the process a core runs next, stealing if it has none
+       // migrated is set if the process last ran on another core
+       // returns its index, -1 if none are ready on any core
+       int take( int core, bool &migrated );
+
+       // moves every ready process to the highest MLFQ level
+       void boost();
+
+    // accessors
+
+       bool isEmpty() const;
+
+       int getCoreCount() const;
+
+       int getSteals( int core ) const;
+
+       int getMigrations( int core ) const;
+
+       // time left, or MLFQ level, of the process a core would take next
+       //   from its own queue, -1 if it has none or the algorithm is
+       //   round robin
+       int getNextKey( int core ) const;
+
+    private:
+
+       // the core with the most ready processes other than core
+       // returns -1 if every other core is empty
+       int victim( int core ) const;
+
+       Scheduler *queues; //one per core
+       int coreCount;
+       int readyCount; //processes in all queues
+       vector<int> lastCore; //core each process last ran on, -1 if none
+       vector<int> steals; //per core
+       vector<int> migrations; //per core
+
+       RunQueues( const RunQueues &copiedQueues );
+       const RunQueues &operator = ( const RunQueues &rhQueues );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_RUNQUEUES_H
@@ -0,0 +1,414 @@
+//RunReport.cpp
+//implements RunReport functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_RUNREPORT_CPP
+#define CLASS_RUNREPORT_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include "RunReport.h"
+
+using namespace std;
+
+//takes a part and a whole
+//returns the part as a fraction of the whole, 0 when the whole is 0
+static double fraction( long part, long whole )
+{
+    return whole > 0 ? (double)part / whole : 0.0;
+}
+
+const char *seconds
+   (
+    long usec,
+    char *text
+   )
+{
+    snprintf( text, 24, "%ld.%06ld", usec / 1000000, usec % 1000000 );
+
+    return text;
+}
+
+const char *averageSeconds
+   (
+    double usec,
+    char *text
+   )
+{
+    snprintf( text, 24, "%.6f", usec * .000001 );
+
+    return text;
+}
+
+string quoted
+   (
+    const string &name,
+    char escape
+   )
+{
+    string text = "\"";
+    unsigned int index;
+
+    for( index = 0; index < name.size(); index++ )
+    {
+        if( name[index] == '"' || ( escape == '\\' && name[index] == '\\' ) )
+        {
+            text += escape;
+        }
+        text += name[index];
+    }
+
+    return text + "\"";
+}
+
+RunReport::RunReport
+   (
+    // no parameters
+   )
+       : elapsed( 0 )
+{
+	// initializers used
+}
+
+void RunReport::setElapsed
+   (
+    long usec
+   )
+{
+    elapsed = usec;
+}
+
+void RunReport::addCpu
+   (
+    long busyTime
+   )
+{
+    cpuBusy.push_back( busyTime );
+}
+
+void RunReport::addProcess
+   (
+    int processNum,
+    const ProcessMetrics &process
+   )
+{
+    processNums.push_back( processNum );
+    processes.push_back( process );
+}
+
+void RunReport::addDevice
+   (
+    const DeviceMetrics &device
+   )
+{
+    devices.push_back( device );
+}
+
+string RunReport::formatTable
+   (
+    // no parameters
+   ) const
+{
+    string table;
+    char line[320], one[24], two[24], three[24], four[24], five[24];
+    unsigned int index;
+    double response, turnaround, waiting;
+
+    table = "Performance summary\n";
+    table += "Process  Response      Turnaround    Waiting       "
+             "CPU           I/O\n";
+    for( index = 0; index < processes.size(); index++ )
+    {
+        const ProcessMetrics &process = processes[index];
+
+        if( process.completion < 0 )
+        {
+            snprintf( line, sizeof( line ), "%-8d did not complete\n",
+                      processNums[index] );
+        }
+        else
+        {
+            snprintf( line, sizeof( line ),
+                      "%-8d %-13s %-13s %-13s %-13s %s\n", processNums[index],
+                      seconds( process.firstRun - process.arrival, one ),
+                      seconds( process.completion - process.arrival, two ),
+                      seconds( process.waitTime, three ),
+                      seconds( process.cpuTime, four ),
+                      seconds( process.ioTime, five ) );
+        }
+        table += line;
+    }
+
+    averages( response, turnaround, waiting );
+    snprintf( line, sizeof( line ), "%-8s %-13s %-13s %s\n", "Average",
+              averageSeconds( response, one ),
+              averageSeconds( turnaround, two ),
+              averageSeconds( waiting, three ) );
+    table += line;
+
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        snprintf( line, sizeof( line ), "CPU %u: %.2f%% utilization\n",
+                  index, 100.0 * fraction( cpuBusy[index], elapsed ) );
+        table += line;
+    }
+
+    for( index = 0; index < devices.size(); index++ )
+    {
+        snprintf( line, sizeof( line ), ": %ld requests, %.2f%% utilization\n",
+                  devices[index].requests,
+                  100.0 * fraction( devices[index].busyTime,
+                                    elapsed * devices[index].units ) );
+        table += devices[index].name + line;
+    }
+
+    return table;
+}
+
+string RunReport::formatJson
+   (
+    // no parameters
+   ) const
+{
+    ostringstream json;
+    char one[24], two[24], three[24], four[24], five[24], six[24];
+    unsigned int index;
+    long busy = 0;
+    double response, turnaround, waiting;
+
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        busy += cpuBusy[index];
+    }
+
+    //built as it goes, a long device name can't cut an object short
+    json << fixed << setprecision( 4 );
+    averages( response, turnaround, waiting );
+    json << "{\n  \"elapsed_sec\": " << seconds( elapsed, one )
+         << ",\n  \"cpu_utilization\": "
+         << fraction( busy, elapsed * (long)cpuBusy.size() )
+         << ",\n  \"average_response_sec\": "
+         << averageSeconds( response, two )
+         << ",\n  \"average_turnaround_sec\": "
+         << averageSeconds( turnaround, three )
+         << ",\n  \"average_waiting_sec\": "
+         << averageSeconds( waiting, four ) << ",\n  \"cpus\": [";
+
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        json << ( index > 0 ? "," : "" ) << "\n    { \"cpu\": " << index
+             << ", \"busy_sec\": " << seconds( cpuBusy[index], one )
+             << ", \"utilization\": " << fraction( cpuBusy[index], elapsed )
+             << " }";
+    }
+
+    json << "\n  ],\n  \"processes\": [";
+    for( index = 0; index < processes.size(); index++ )
+    {
+        const ProcessMetrics &process = processes[index];
+
+        json << ( index > 0 ? "," : "" ) << "\n    { \"process\": "
+             << processNums[index] << ", \"completed\": "
+             << ( process.completion < 0 ? "false" : "true" )
+             << ", \"arrival_sec\": " << seconds( process.arrival, one )
+             << ", \"response_sec\": "
+             << seconds( process.firstRun < 0 ? 0
+                         : process.firstRun - process.arrival, two )
+             << ", \"turnaround_sec\": "
+             << seconds( process.completion < 0 ? 0
+                         : process.completion - process.arrival, three )
+             << ", \"waiting_sec\": " << seconds( process.waitTime, four )
+             << ", \"cpu_sec\": " << seconds( process.cpuTime, five )
+             << ", \"io_sec\": " << seconds( process.ioTime, six )
+             << ", \"dispatches\": " << process.dispatches << " }";
+    }
+
+    json << "\n  ],\n  \"devices\": [";
+    for( index = 0; index < devices.size(); index++ )
+    {
+        json << ( index > 0 ? "," : "" ) << "\n    { \"device\": "
+             << quoted( devices[index].name, '\\' ) << ", \"units\": "
+             << devices[index].units << ", \"requests\": "
+             << devices[index].requests << ", \"busy_sec\": "
+             << seconds( devices[index].busyTime, one )
+             << ", \"utilization\": "
+             << fraction( devices[index].busyTime,
+                          elapsed * devices[index].units ) << " }";
+    }
+    json << "\n  ]\n}\n";
+
+    return json.str();
+}
+
+string RunReport::formatCsv
+   (
+    // no parameters
+   ) const
+{
+    string csv;
+    char text[512], one[24], two[24], three[24], four[24], five[24];
+    char six[24];
+    unsigned int index;
+    long busy = 0;
+    double response, turnaround, waiting;
+
+    csv = "record,id,arrival_sec,response_sec,turnaround_sec,waiting_sec,"
+          "cpu_sec,io_sec,dispatches,requests,busy_sec,utilization\n";
+
+    for( index = 0; index < processes.size(); index++ )
+    {
+        const ProcessMetrics &process = processes[index];
+
+        if( process.completion < 0 ) //times past the end are left empty
+        {
+            snprintf( text, sizeof( text ), "process,%d,%s,,,%s,%s,%s,%d,,,\n",
+                      processNums[index], seconds( process.arrival, one ),
+                      seconds( process.waitTime, four ),
+                      seconds( process.cpuTime, five ),
+                      seconds( process.ioTime, six ), process.dispatches );
+        }
+        else
+        {
+            snprintf( text, sizeof( text ),
+                      "process,%d,%s,%s,%s,%s,%s,%s,%d,,,\n",
+                      processNums[index], seconds( process.arrival, one ),
+                      seconds( process.firstRun - process.arrival, two ),
+                      seconds( process.completion - process.arrival, three ),
+                      seconds( process.waitTime, four ),
+                      seconds( process.cpuTime, five ),
+                      seconds( process.ioTime, six ), process.dispatches );
+        }
+        csv += text;
+    }
+
+    for( index = 0; index < devices.size(); index++ )
+    {
+        snprintf( text, sizeof( text ), ",,,,,,,,%ld,%s,%.4f\n",
+                  devices[index].requests,
+                  seconds( devices[index].busyTime, one ),
+                  fraction( devices[index].busyTime,
+                            elapsed * devices[index].units ) );
+        csv += "device," + quoted( devices[index].name, '"' ) + text;
+    }
+
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        busy += cpuBusy[index];
+        snprintf( text, sizeof( text ), "cpu,%u,,,,,,,,,%s,%.4f\n", index,
+                  seconds( cpuBusy[index], one ),
+                  fraction( cpuBusy[index], elapsed ) );
+        csv += text;
+    }
+
+    averages( response, turnaround, waiting );
+    snprintf( text, sizeof( text ), "total,,,%s,%s,%s,,,,,%s,%.4f\n",
+              averageSeconds( response, one ),
+              averageSeconds( turnaround, two ),
+              averageSeconds( waiting, three ), seconds( elapsed, four ),
+              fraction( busy, elapsed * (long)cpuBusy.size() ) );
+    csv += text;
+
+    return csv;
+}
+
+bool RunReport::write
+   (
+    const string &path
+   ) const
+{
+    ofstream fout( path.c_str() );
+    bool csv = ( path.size() > 4
+                 && path.compare( path.size() - 4, 4, ".csv" ) == 0 );
+
+    if( !fout )
+    {
+        return false;
+    }
+
+    fout << ( csv ? formatCsv() : formatJson() );
+
+    return fout.good();
+}
+
+long RunReport::getElapsed
+   (
+    // no parameters
+   ) const
+{
+    return elapsed;
+}
+
+double RunReport::getCpuUtilization
+   (
+    // no parameters
+   ) const
+{
+    unsigned int index;
+    long busy = 0;
+
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        busy += cpuBusy[index];
+    }
+
+    return fraction( busy, elapsed * (long)cpuBusy.size() );
+}
+
+int RunReport::getCompleted
+   (
+    // no parameters
+   ) const
+{
+    unsigned int index;
+    int completed = 0;
+
+    for( index = 0; index < processes.size(); index++ )
+    {
+        if( processes[index].completion >= 0 )
+        {
+            completed++;
+        }
+    }
+
+    return completed;
+}
+
+void RunReport::averages
+   (
+    double &response,
+    double &turnaround,
+    double &waiting
+   ) const
+{
+    unsigned int index;
+    long completed = 0;
+
+    response = turnaround = waiting = 0;
+    for( index = 0; index < processes.size(); index++ )
+    {
+        if( processes[index].completion >= 0 )
+        {
+            response += processes[index].firstRun - processes[index].arrival;
+            turnaround += processes[index].completion
+                          - processes[index].arrival;
+            waiting += processes[index].waitTime;
+            completed++;
+        }
+    }
+
+    if( completed > 0 )
+    {
+        response /= completed;
+        turnaround /= completed;
+        waiting /= completed;
+    }
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_RUNREPORT_CPP
@@ -0,0 +1,131 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file RunReport.h
+ *
+ * @brief Definition file for RunReport class
+ *
+ * @details Specifies the performance summary written at the end of a run.
+ *          The simulator fills in the times of every process, how long each
+ *          CPU was busy and how much each device was used. The report then
+ *          works out response, turnaround and waiting times and CPU and
+ *          device utilization. It is formatted as a table for the log, and
+ *          as JSON or CSV for scripts comparing many runs. Times are in
+ *          microseconds of simulation time and printed in seconds.
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_RUNREPORT_H
+#define CLASS_RUNREPORT_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//times one process spent in each state, kept while it runs
+struct ProcessMetrics
+{
+    long arrival; //admitted to a run queue
+    long firstRun; //first taken by a CPU, -1 if never
+    long completion; //completed, -1 if never
+    long waitTime; //READY in a run queue
+    long cpuTime; //on a CPU
+    long ioTime; //WAITING for I/O
+    int dispatches; //times taken by a CPU
+};
+
+//use of one I/O device over the run
+struct DeviceMetrics
+{
+    string name;
+    int units;
+    long requests;
+    long busyTime; //summed over its units
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class RunReport
+   {
+    public:
+
+    // constructors
+    RunReport();
+
+    // modifiers
+
+       // sets the length of the run
+       void setElapsed( long usec );
+
+       // adds the next CPU and the time it ran processes
+       void addCpu( long busyTime );
+
+       // adds a process by its number
+       void addProcess( int processNum, const ProcessMetrics &process );
+
+       // adds a device that took at least one request
+       void addDevice( const DeviceMetrics &device );
+
+    // accessors
+
+       // returns the summary as text lines for the log
+       string formatTable() const;
+
+       // returns the summary as one JSON object
+       string formatJson() const;
+
+       // returns one CSV row per process, device and CPU, and a total row
+       string formatCsv() const;
+
+       // writes the report as CSV when the path ends in .csv, JSON
+       //   otherwise
+       // returns false if the file can't be created
+       bool write( const string &path ) const;
+
+       // length of the run in usec
+       long getElapsed() const;
+
+       // busy time of every CPU as a fraction of the run
+       double getCpuUtilization() const;
+
+       // processes that completed
+       int getCompleted() const;
+
+       // averages in usec over the processes that completed
+       void averages( double &response, double &turnaround,
+                      double &waiting ) const;
+
+    private:
+
+       long elapsed;
+       vector<long> cpuBusy;
+       vector<int> processNums;
+       vector<ProcessMetrics> processes;
+       vector<DeviceMetrics> devices;
+   };
+
+// Function prototypes ////////////////////////////////////////////////////////
+
+//takes usec and a buffer of at least 24 chars
+//returns the buffer holding it as seconds, the way log lines show time
+const char *seconds( long usec, char *text );
+
+//takes an average in usec and a buffer of at least 24 chars
+//returns the buffer holding it as seconds, rounded to the usec
+const char *averageSeconds( double usec, char *text );
+
+//takes a name and the escape char, '\\' for JSON or '"' for CSV
+//returns it in quotes with its quotes escaped, and its backslashes too
+//  for JSON
+string quoted( const string &name, char escape );
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_RUNREPORT_H
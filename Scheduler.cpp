@@ -0,0 +1,218 @@
+//Scheduler.cpp
+//implements Scheduler functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SCHEDULER_CPP
+#define CLASS_SCHEDULER_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "Scheduler.h"
+
+using namespace std;
+
+Scheduler::Scheduler
+   (
+    // no parameters
+   )
+       : algorithm( RR ), queued( 0 )
+{
+	// initializers used
+}
+
+void Scheduler::init
+   (
+    int algorithmId,
+    int levelCount
+   )
+{
+    algorithm = algorithmId;
+    levels.clear();
+    levels.resize( algorithm == MLFQ ? levelCount : 1 );
+    queued = 0;
+    heap.clear();
+}
+
+void Scheduler::add
+   (
+    int index,
+    int order,
+    int level
+   )
+{
+    if( algorithm == RR || algorithm == MLFQ )
+    {
+        levels[min( level, (int)levels.size() - 1 )].enqueue( index );
+        queued++;
+        return;
+    }
+
+    HeapEntry entry = { order, index };
+
+    heap.push_back( entry );
+    siftUp( heap.size() - 1 );
+}
+
+int Scheduler::take
+   (
+    // no parameters
+   )
+{
+    unsigned int level;
+    int index;
+
+    if( algorithm == RR || algorithm == MLFQ )
+    {
+        for( level = 0; level < levels.size(); level++ )
+        {
+            if( levels[level].dequeue( index ) )
+            {
+                queued--;
+                return index;
+            }
+        }
+
+        return -1;
+    }
+
+    if( heap.empty() )
+    {
+        return -1;
+    }
+
+    //the last entry fills the gap, then finds its place
+    index = heap[0].index;
+    heap[0] = heap.back();
+    heap.pop_back();
+    siftDown( 0 );
+
+    return index;
+}
+
+void Scheduler::boost
+   (
+    // no parameters
+   )
+{
+    unsigned int level;
+    int index;
+
+    for( level = 1; level < levels.size(); level++ )
+    {
+        while( levels[level].dequeue( index ) )
+        {
+            levels[0].enqueue( index );
+        }
+    }
+}
+
+bool Scheduler::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    return getSize() == 0;
+}
+
+int Scheduler::getSize
+   (
+    // no parameters
+   ) const
+{
+    if( algorithm == RR || algorithm == MLFQ )
+    {
+        return queued;
+    }
+
+    return heap.size();
+}
+
+int Scheduler::getNextKey
+   (
+    // no parameters
+   ) const
+{
+    unsigned int level;
+
+    if( algorithm == MLFQ )
+    {
+        for( level = 0; level < levels.size(); level++ )
+        {
+            if( !levels[level].isEmpty() )
+            {
+                return level;
+            }
+        }
+    }
+
+    if( algorithm == RR || algorithm == MLFQ || heap.empty() )
+    {
+        return -1;
+    }
+
+    return heap[0].order;
+}
+
+bool Scheduler::before
+   (
+    const HeapEntry &one,
+    const HeapEntry &other
+   ) const
+{
+    if( one.order != other.order )
+    {
+        return one.order < other.order;
+    }
+
+    return one.index < other.index;
+}
+
+void Scheduler::siftUp
+   (
+    int at
+   )
+{
+    int parent;
+
+    while( at > 0 )
+    {
+        parent = ( at - 1 ) / 2;
+        if( !before( heap[at], heap[parent] ) )
+        {
+            break;
+        }
+
+        swap( heap[at], heap[parent] );
+        at = parent;
+    }
+}
+
+void Scheduler::siftDown
+   (
+    int at
+   )
+{
+    int child, size = heap.size();
+
+    while( ( child = 2 * at + 1 ) < size )
+    {
+        if( child + 1 < size && before( heap[child + 1], heap[child] ) )
+        {
+            child++;
+        }
+
+        if( !before( heap[child], heap[at] ) )
+        {
+            break;
+        }
+
+        swap( heap[at], heap[child] );
+        at = child;
+    }
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SCHEDULER_CPP
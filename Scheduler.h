@@ -0,0 +1,108 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file Scheduler.h
+ *
+ * @brief Definition file for Scheduler class
+ *
+ * @details Specifies the ready structure the simulator picks processes from.
+ *          Round robin keeps ready processes in a queue and puts a process
+ *          that ran at the back. MLFQ keeps such a queue for every priority
+ *          level and takes from the highest level that has a process, the
+ *          caller says which level a process goes in, and a boost moves
+ *          every process up to the top one. SJF and SRTF keep a min-heap
+ *          ordered by the number given when a process is added, the time
+ *          it has left for SRTF and the length of its job for SJF, ties
+ *          going to the lower process index. A process is taken out
+ *          while a CPU runs it and added back if it is still ready, so
+ *          several CPUs can share one scheduler. Processes are referred to
+ *          by their index in the process list. Heap entries carry their own
+ *          order, so a scheduler only grows with the processes it holds.
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SCHEDULER_H
+#define CLASS_SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "SimpleQueue.cpp"
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//Scheduling algorithm identifiers
+static const int RR = 0,
+                 SRTF = 1,
+                 SJF = 2,
+                 MLFQ = 3;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class Scheduler
+   {
+    public:
+
+    // constructors
+    Scheduler();
+
+    // modifiers
+
+       // empties the scheduler and selects the algorithm, levelCount is
+       //   the number of MLFQ priority levels
+       void init( int algorithmId, int levelCount );
+
+       // adds a ready process, SJF and SRTF take the lowest order first,
+       //   MLFQ puts it at the back of a level from 0, the highest
+       void add( int index, int order, int level );
+
+       // takes out the process to run next
+       // returns its index, -1 if none are ready
+       int take();
+
+       // moves every process to the back of the highest level, in level
+       //   order
+       void boost();
+
+    // accessors
+
+       bool isEmpty() const;
+
+       // number of ready processes
+       int getSize() const;
+
+       // what orders the process take() returns next, its time left for
+       //   SJF and SRTF or its level for MLFQ, -1 for round robin or when
+       //   none are ready
+       int getNextKey() const;
+
+    private:
+
+       // one process in the heap and what orders it
+       struct HeapEntry
+       {
+           int order;
+           int index;
+       };
+
+       // heap order, lower order first, then lower index
+       bool before( const HeapEntry &one, const HeapEntry &other ) const;
+
+       // move the heap entry at a position up or down to its place
+       void siftUp( int at );
+       void siftDown( int at );
+
+       int algorithm;
+       vector< SimpleQueue<int> > levels; //round robin order of each
+                                          //  level, RR uses one
+       int queued; //processes in levels
+       vector<HeapEntry> heap; //SJF and SRTF
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SCHEDULER_H
@@ -0,0 +1,281 @@
+//SimClock.cpp
+//implements SimClock functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMCLOCK_CPP
+#define CLASS_SIMCLOCK_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "SimClock.h"
+#include "SimulatorFunctions.h"
+
+using namespace std;
+
+SimClock::SimClock
+   (
+    // no parameters
+   )
+       : virtualMode( false ), virtualTime( 0 ), wakeSeq( 0 ), active( 1 )
+{
+    pthread_mutex_init( &mutex, NULL );
+    gettimeofday( &startTime, NULL );
+}
+
+SimClock::~SimClock
+   (
+    // no parameters
+   )
+{
+    pthread_mutex_destroy( &mutex );
+}
+
+void SimClock::start
+   (
+    bool useVirtual
+   )
+{
+    virtualMode = useVirtual;
+    virtualTime = 0;
+    active = 1; //calling thread
+    gettimeofday( &startTime, NULL );
+}
+
+void SimClock::addThread
+   (
+    // no parameters
+   )
+{
+    lock();
+    active++;
+    unlock();
+}
+
+void SimClock::removeThread
+   (
+    // no parameters
+   )
+{
+    lock();
+    active--;
+    advance();
+    unlock();
+}
+
+void SimClock::wait
+   (
+    long long usec
+   )
+{
+    struct timeval current;
+    WakeEvent event;
+    pthread_cond_t cond;
+    bool woken = false;
+
+    if( !virtualMode )
+    {
+        gettimeofday( &current, NULL );
+        while( timePassed( current ) < usec ); //wait
+        return;
+    }
+
+    pthread_cond_init( &cond, NULL );
+
+    lock();
+    event.time = virtualTime + usec;
+    event.seq = wakeSeq++;
+    event.cond = &cond;
+    event.woken = &woken;
+    wakeEvents.push( event );
+
+    active--;
+    advance(); //wakes this thread straight away if it is the earliest
+
+    while( !woken )
+    {
+        pthread_cond_wait( &cond, &mutex );
+    }
+    unlock();
+
+    pthread_cond_destroy( &cond );
+}
+
+void SimClock::lock
+   (
+    // no parameters
+   )
+{
+    pthread_mutex_lock( &mutex );
+}
+
+void SimClock::unlock
+   (
+    // no parameters
+   )
+{
+    pthread_mutex_unlock( &mutex );
+}
+
+void SimClock::block
+   (
+    SimCondition &condition
+   )
+{
+    long generation = condition.generation;
+    SimWaiter waiter;
+    pthread_cond_t cond;
+    bool woken = false;
+
+    if( virtualMode )
+    {
+        pthread_cond_init( &cond, NULL );
+        waiter.cond = &cond;
+        waiter.woken = &woken;
+        condition.waiters.push_back( waiter );
+
+        active--;
+        advance();
+
+        //advance() counts this thread as active again before waking it
+        while( !woken )
+        {
+            pthread_cond_wait( &cond, &mutex );
+        }
+
+        pthread_cond_destroy( &cond );
+        return;
+    }
+
+    condition.blocked++;
+    active--;
+    advance();
+
+    //notify() counts this thread as active again before waking it
+    while( condition.generation == generation )
+    {
+        pthread_cond_wait( &condition.cond, &mutex );
+    }
+}
+
+void SimClock::notify
+   (
+    SimCondition &condition
+   )
+{
+    WakeEvent event;
+    unsigned int index;
+
+    //run the woken threads as wake events at the current time
+    for( index = 0; index < condition.waiters.size(); index++ )
+    {
+        event.time = virtualTime;
+        event.seq = wakeSeq++;
+        event.cond = condition.waiters[index].cond;
+        event.woken = condition.waiters[index].woken;
+        wakeEvents.push( event );
+    }
+    condition.waiters.clear();
+
+    if( condition.blocked > 0 )
+    {
+        active += condition.blocked;
+        condition.blocked = 0;
+        condition.generation++;
+        pthread_cond_broadcast( &condition.cond );
+    }
+}
+
+void SimClock::initCondition
+   (
+    SimCondition &condition
+   )
+{
+    pthread_cond_init( &condition.cond, NULL );
+    condition.blocked = 0;
+    condition.generation = 0;
+}
+
+void SimClock::destroyCondition
+   (
+    SimCondition &condition
+   )
+{
+    pthread_cond_destroy( &condition.cond );
+}
+
+long long SimClock::now
+   (
+    // no parameters
+   )
+{
+    if( !virtualMode )
+    {
+        return timePassed( startTime );
+    }
+
+    return virtualTime.load();
+}
+
+long long SimClock::getNextWake
+   (
+    // no parameters
+   ) const
+{
+    if( !virtualMode || wakeEvents.empty() )
+    {
+        return -1;
+    }
+
+    return wakeEvents.top().time;
+}
+
+bool SimClock::isVirtual
+   (
+    // no parameters
+   ) const
+{
+    return virtualMode;
+}
+
+bool SimClock::WakeOrder::operator()
+   (
+    const WakeEvent &one,
+    const WakeEvent &other
+   ) const
+{
+    //priority_queue keeps the largest on top, so order is reversed
+    if( one.time != other.time )
+    {
+        return one.time > other.time;
+    }
+
+    return one.seq > other.seq;
+}
+
+void SimClock::advance
+   (
+    // no parameters
+   )
+{
+    WakeEvent event;
+
+    while( virtualMode && active == 0 && !wakeEvents.empty() )
+    {
+        event = wakeEvents.top();
+        wakeEvents.pop();
+
+        if( event.time > virtualTime )
+        {
+            virtualTime = event.time;
+        }
+
+        *event.woken = true;
+        active++;
+        pthread_cond_signal( event.cond );
+    }
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMCLOCK_CPP
@@ -0,0 +1,144 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file SimClock.h
+ *
+ * @brief Definition file for SimClock class
+ *
+ * @details Specifies the simulation clock used by every simulator thread.
+ *          In wall clock mode the clock reads real elapsed time and waits by
+ *          spinning, exactly like the original timer loops. In virtual mode
+ *          the clock is a discrete event engine: a waiting thread posts a
+ *          wake event to a priority queue, and once every simulator thread
+ *          is waiting or blocked the clock jumps to the earliest event.
+ *          All blocking between simulator threads goes through block() and
+ *          notify() so the engine knows which threads can still make
+ *          progress at the current virtual time. Threads woken in virtual
+ *          mode run one at a time in wake order, so a run never depends on
+ *          how the host schedules them.
+ *
+ * @Note Conditions are only valid while the clock lock is held
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMCLOCK_H
+#define CLASS_SIMCLOCK_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <sys/time.h>
+#include <atomic>
+#include <queue>
+#include <vector>
+
+using namespace std;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//a thread blocked on a SimCondition in virtual mode
+struct SimWaiter
+{
+    pthread_cond_t* cond;
+    bool* woken;
+};
+
+//a condition simulator threads can block on under the clock lock
+struct SimCondition
+{
+    pthread_cond_t cond;
+    int blocked; //threads currently blocked on this condition
+    long generation; //bumped on every notify
+    vector<SimWaiter> waiters; //virtual mode, in the order they blocked
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class SimClock
+   {
+    public:
+
+    // constructors
+    SimClock();
+
+    // destructor
+    ~SimClock();
+
+    // modifiers
+
+       // resets the clock to zero, selects wall clock or virtual time
+       void start( bool useVirtual );
+
+       // registers a new simulator thread before it is created
+       void addThread();
+
+       // removes the calling simulator thread when it exits
+       void removeThread();
+
+       // advances simulated time by the given number of microseconds
+       void wait( long long usec );
+
+       // clock lock, guards every SimCondition and the state it protects
+       void lock();
+       void unlock();
+
+       // blocks the calling thread until the condition is notified
+       // lock must be held
+       void block( SimCondition &condition );
+
+       // wakes every thread blocked on the condition
+       // in virtual mode they are queued to run one at a time, in the order
+       //   they blocked, once the calling thread waits or blocks
+       // lock must be held
+       void notify( SimCondition &condition );
+
+       void initCondition( SimCondition &condition );
+       void destroyCondition( SimCondition &condition );
+
+    // accessors
+
+       // microseconds of simulated time since start()
+       long long now();
+
+       // virtual time of the earliest thread waiting for a time, -1 if
+       //   none is or in wall clock mode
+       // lock must be held
+       long long getNextWake() const;
+
+       bool isVirtual() const;
+
+    private:
+
+       // one thread sleeping until a point in virtual time
+       struct WakeEvent
+       {
+           long long time;
+           long seq; //keeps wake order stable for equal times
+           pthread_cond_t* cond;
+           bool* woken;
+       };
+
+       struct WakeOrder
+       {
+           bool operator()( const WakeEvent &one, const WakeEvent &other ) const;
+       };
+
+       // moves virtual time forward while no thread can make progress
+       // lock must be held
+       void advance();
+
+       bool virtualMode;
+       struct timeval startTime;
+       atomic<long long> virtualTime; //written under lock, read without it
+       long wakeSeq;
+       int active; //simulator threads not waiting or blocked
+       pthread_mutex_t mutex;
+       priority_queue<WakeEvent, vector<WakeEvent>, WakeOrder> wakeEvents;
+
+       SimClock( const SimClock &copiedClock );
+       const SimClock &operator = ( const SimClock &rhClock );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMCLOCK_H
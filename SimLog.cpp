@@ -0,0 +1,279 @@
+//SimLog.cpp
+//implements SimLog functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMLOG_CPP
+#define CLASS_SIMLOG_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <sched.h>
+#include <time.h>
+#include "SimLog.h"
+
+using namespace std;
+
+//hands out a distinct id to every log
+static atomic<int> nextLogId( 0 );
+
+//ring of the log the calling thread wrote to last
+static thread_local int localLogId = -1;
+static thread_local void* localLogRing = NULL;
+
+//how long the merger sleeps when every ring is empty
+static const long MERGER_IDLE_NSEC = 100000;
+
+//bytes handed to a sink at once
+static const int MERGE_BATCH_SIZE = 8192;
+
+SimLog::SimLog
+   (
+    // no parameters
+   )
+       : clock( NULL ), devices( NULL ), text( NULL ), binary( NULL ),
+         logId( nextLogId++ ), rings( NULL ), nextSeq( 0 ), stopping( false ),
+         mergedSeq( 0 ), running( false )
+{
+	// initializers used
+}
+
+SimLog::~SimLog
+   (
+    // no parameters
+   )
+{
+    LogRing* ring;
+
+    stop();
+
+    while( ( ring = rings.load() ) != NULL )
+    {
+        rings = ring->next;
+        delete ring;
+    }
+}
+
+void SimLog::start
+   (
+    SimClock *simClock,
+    const LogDevices *logDevices,
+    LogSink *textSink,
+    LogSink *binarySink
+   )
+{
+    clock = simClock;
+    devices = logDevices;
+    text = textSink;
+    binary = binarySink;
+    stopping = false;
+    window.resize( WINDOW_SIZE );
+    windowUsed.assign( WINDOW_SIZE, false );
+
+    running = true;
+    pthread_create( &merger, NULL, mergerMain, (void*)this );
+}
+
+void SimLog::write
+   (
+    unsigned char event,
+    int processNum,
+    unsigned int value,
+    unsigned short device
+   )
+{
+    LogRing* ring = localRing();
+    unsigned int tail = ring->tail.load( memory_order_relaxed );
+    LogRecord* record;
+    unsigned int seq;
+    long time;
+
+    //full ring, wait for the merger before taking a sequence number
+    while( tail - ring->head.load( memory_order_acquire ) == RING_SIZE )
+    {
+        sched_yield();
+    }
+
+    //the time is read after the record before this one took its number
+    //  and before this one takes the next, tried again if another thread
+    //  took it in between, so a later number never has an earlier time
+    seq = nextSeq.load( memory_order_acquire );
+    do
+    {
+        time = clock->now();
+    }
+    while( !nextSeq.compare_exchange_weak( seq, seq + 1 ) );
+
+    record = &ring->records[ tail & ( RING_SIZE - 1 ) ];
+    record->time = time;
+    record->seq = seq;
+    record->processNum = processNum;
+    record->value = value;
+    record->device = device;
+    record->event = event;
+    record->core = ring->core;
+
+    ring->tail.store( tail + 1, memory_order_release );
+}
+
+void SimLog::setCore
+   (
+    unsigned char core
+   )
+{
+    localRing()->core = core;
+}
+
+void SimLog::stop
+   (
+    // no parameters
+   )
+{
+    if( running )
+    {
+        stopping = true;
+        pthread_join( merger, NULL );
+        running = false;
+    }
+}
+
+SimLog::LogRing* SimLog::localRing
+   (
+    // no parameters
+   )
+{
+    LogRing* ring;
+
+    if( localLogId == logId )
+    {
+        return (LogRing*)localLogRing;
+    }
+
+    ring = new LogRing;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->core = 0;
+
+    //add to the list the merger walks
+    ring->next = rings.load();
+    while( !rings.compare_exchange_weak( ring->next, ring ) );
+
+    localLogId = logId;
+    localLogRing = (void*)ring;
+
+    return ring;
+}
+
+void* SimLog::mergerMain
+   (
+    void* arg
+   )
+{
+    SimLog* log = (SimLog*)arg;
+    struct timespec idle = { 0, MERGER_IDLE_NSEC };
+
+    while( !log->stopping )
+    {
+        if( !log->merge() )
+        {
+            nanosleep( &idle, NULL );
+        }
+    }
+
+    //writers are done, everything handed out is in a ring
+    do
+    {
+        log->merge();
+    } while( log->mergedSeq != log->nextSeq.load() );
+
+    return NULL;
+}
+
+bool SimLog::merge
+   (
+    // no parameters
+   )
+{
+    LogRing* ring;
+    unsigned int head, tail, slot;
+    bool moved = false;
+    char textBatch[ MERGE_BATCH_SIZE ];
+    char binaryBatch[ MERGE_BATCH_SIZE ];
+    int textLength = 0, binaryLength = 0;
+
+    for( ring = rings.load(); ring != NULL; ring = ring->next )
+    {
+        head = ring->head.load( memory_order_relaxed );
+        tail = ring->tail.load( memory_order_acquire );
+
+        while( head != tail )
+        {
+            const LogRecord &record = ring->records[ head & ( RING_SIZE - 1 ) ];
+
+            //too far ahead, leave it until the window catches up
+            if( record.seq - mergedSeq >= WINDOW_SIZE )
+            {
+                break;
+            }
+
+            slot = record.seq & ( WINDOW_SIZE - 1 );
+            window[ slot ] = record;
+            windowUsed[ slot ] = true;
+            head++;
+            moved = true;
+        }
+
+        ring->head.store( head, memory_order_release );
+    }
+
+    //write every record that is next in order
+    while( windowUsed[ mergedSeq & ( WINDOW_SIZE - 1 ) ] )
+    {
+        slot = mergedSeq & ( WINDOW_SIZE - 1 );
+
+        if( text != NULL )
+        {
+            if( textLength > MERGE_BATCH_SIZE - LOG_LINE_SIZE - 1 )
+            {
+                text->write( textBatch, textLength );
+                textLength = 0;
+            }
+
+            textLength += formatLogRecord( window[ slot ], *devices,
+                                           textBatch + textLength );
+            textBatch[ textLength++ ] = '\n';
+        }
+
+        if( binary != NULL )
+        {
+            if( binaryLength > MERGE_BATCH_SIZE - LOG_BINARY_SIZE )
+            {
+                binary->write( binaryBatch, binaryLength );
+                binaryLength = 0;
+            }
+
+            binaryLength += encodeLogRecord( window[ slot ],
+                                             binaryBatch + binaryLength );
+        }
+
+        windowUsed[ slot ] = false;
+        mergedSeq++;
+    }
+
+    if( textLength > 0 )
+    {
+        text->write( textBatch, textLength );
+    }
+
+    if( binaryLength > 0 )
+    {
+        binary->write( binaryBatch, binaryLength );
+    }
+
+    return moved;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMLOG_CPP
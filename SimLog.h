@@ -0,0 +1,114 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file SimLog.h
+ *
+ * @brief Definition file for SimLog class and log records
+ *
+ * @details Specifies the simulator log. Each thread that writes to the log
+ *          gets its own single producer ring of fixed size binary records,
+ *          so writers never share a lock. Every record is stamped with the
+ *          simulation time and a global sequence number, the time read
+ *          while the number is still the next one free, so records in
+ *          sequence order never go back in time. A background merger
+ *          drains the rings, puts records back in sequence order and
+ *          writes them to a text LogSink, a binary LogSink or both.
+ *
+ * @Note write() may be called from any thread between start() and stop()
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMLOG_H
+#define CLASS_SIMLOG_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <atomic>
+#include <vector>
+#include "SimClock.h"
+#include "LogSink.h"
+#include "LogFormat.h"
+
+using namespace std;
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class SimLog
+   {
+    public:
+
+    // records in each thread's ring, must be a power of two
+    static const unsigned int RING_SIZE = 4096;
+
+    // records held while waiting for an earlier one, power of two
+    static const unsigned int WINDOW_SIZE = 65536;
+
+    // constructors
+    SimLog();
+
+    // destructor
+    ~SimLog();
+
+    // modifiers
+
+       // starts the merger, text lines naming devices from logDevices are
+       //   written to textSink and binary records to binarySink, either
+       //   sink may be NULL
+       void start( SimClock *simClock, const LogDevices *logDevices,
+                   LogSink *textSink, LogSink *binarySink = NULL );
+
+       // adds a record for the calling thread, stamped with the clock time
+       void write( unsigned char event, int processNum = 0,
+                   unsigned int value = 0, unsigned short device = 0 );
+
+       // sets the core stored with every record the calling thread writes
+       //   from now on, 0 when it is not a simulated CPU
+       void setCore( unsigned char core );
+
+       // merges every record still in the rings and stops the merger
+       void stop();
+
+    private:
+
+       // one writer thread's records, written by it and read by the merger
+       struct LogRing
+       {
+           LogRecord records[ RING_SIZE ];
+           atomic<unsigned int> head; //next record to read
+           atomic<unsigned int> tail; //next record to write
+           LogRing* next; //rings form a list, newest first
+           unsigned char core; //stored in every record of the ring
+       };
+
+       // finds or creates the calling thread's ring
+       LogRing* localRing();
+
+       // merger thread entry point, arg is the log
+       static void* mergerMain( void* arg );
+
+       // moves records from the rings to the window and writes every
+       // record that is next in sequence, returns true if any were moved
+       bool merge();
+
+       SimClock *clock;
+       const LogDevices *devices;
+       LogSink *text;
+       LogSink *binary;
+       int logId; //tells this log's rings apart from another log's
+       atomic<LogRing*> rings;
+       atomic<unsigned int> nextSeq; //next sequence number to hand out
+       atomic<bool> stopping;
+       vector<LogRecord> window; //records waiting for their turn
+       vector<bool> windowUsed;
+       unsigned int mergedSeq; //next sequence number to write
+       pthread_t merger;
+       bool running;
+
+       SimLog( const SimLog &copiedLog );
+       const SimLog &operator = ( const SimLog &rhLog );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMLOG_H
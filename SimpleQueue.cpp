@@ -4,6 +4,7 @@
 //implements SimpleQueue functions
 //Modified for CS446 Assignment 2
 //9/24/16
+//Rewritten as a ring buffer
 
 // Precompiler directives /////////////////////////////////////////////////////
 
@@ -12,6 +13,7 @@
 
 // Header files ///////////////////////////////////////////////////////////////
 
+#include <utility>
 #include "SimpleQueue.h"
 
 using namespace std;
@@ -21,7 +23,8 @@ SimpleQueue<DataType>::SimpleQueue
    (
    	// no parameters
    )
-       : SimpleList<DataType>( INITIAL_CAPACITY ), queueSize( 0 )
+       : queueData( new DataType[ INITIAL_CAPACITY ] ),
+         queueCapacity( INITIAL_CAPACITY ), head( 0 ), tail( 0 )
 {
 	// initializers used
 }
@@ -29,22 +32,45 @@ SimpleQueue<DataType>::SimpleQueue
 template <class DataType>
 SimpleQueue<DataType>::SimpleQueue
    (
-    const SimpleQueue &copiedQueue 
-   ) 
-       : SimpleList<DataType>( copiedQueue ),
-         queueSize( copiedQueue.queueSize )
+    const SimpleQueue &copiedQueue
+   )
+       : queueData( new DataType[ copiedQueue.queueCapacity ] ),
+         queueCapacity( copiedQueue.queueCapacity ),
+         head( 0 ), tail( 0 )
+{
+	unsigned int index;
+
+	for( index = copiedQueue.head; index != copiedQueue.tail; index++ )
+	{
+		queueData[ tail ] =
+		           copiedQueue.queueData[ index & ( queueCapacity - 1 ) ];
+		tail++;
+	}
+}
+
+template <class DataType>
+SimpleQueue<DataType>::SimpleQueue
+   (
+    SimpleQueue &&movedQueue
+   ) noexcept
+       : queueData( movedQueue.queueData ),
+         queueCapacity( movedQueue.queueCapacity ),
+         head( movedQueue.head ), tail( movedQueue.tail )
 {
-	this->copyList( this->listData, copiedQueue.listData, queueSize );
-	//this->listData( copiedQueue.listData );
+	//moved queue keeps no buffer until it is assigned again
+	movedQueue.queueData = NULL;
+	movedQueue.queueCapacity = 0;
+	movedQueue.head = 0;
+	movedQueue.tail = 0;
 }
 
 template <class DataType>
 SimpleQueue<DataType>::~SimpleQueue
    (
-    // no parameters 
-   ) 
+    // no parameters
+   )
 {
-	//parent destructor called
+	delete [] queueData;
 }
 
 template <class DataType>
@@ -55,7 +81,33 @@ const SimpleQueue<DataType>& SimpleQueue<DataType>::operator =
 {
 	if( this != &rhQueue )
 	{
-		*this = rhQueue;
+		SimpleQueue copiedQueue( rhQueue );
+
+		*this = std::move( copiedQueue );
+	}
+
+	return *this;
+}
+
+template <class DataType>
+const SimpleQueue<DataType>& SimpleQueue<DataType>::operator =
+   (
+    SimpleQueue &&rhQueue
+   ) noexcept
+{
+	if( this != &rhQueue )
+	{
+		delete [] queueData;
+
+		queueData = rhQueue.queueData;
+		queueCapacity = rhQueue.queueCapacity;
+		head = rhQueue.head;
+		tail = rhQueue.tail;
+
+		rhQueue.queueData = NULL;
+		rhQueue.queueCapacity = 0;
+		rhQueue.head = 0;
+		rhQueue.tail = 0;
 	}
 
 	return *this;
@@ -68,41 +120,58 @@ bool SimpleQueue<DataType>::isEmpty
    	// no parameters
    ) const
 {
-	return ( queueSize == 0 );
+	return ( head == tail );
+}
+
+template <class DataType>
+int SimpleQueue<DataType>::getSize
+   (
+   	// no parameters
+   ) const
+{
+	return (int)( tail - head );
 }
 
 template <class DataType>
 void SimpleQueue<DataType>::enqueue
    (
-    const DataType &enqueueData 
+    const DataType &enqueueData
    )
 {
-	if( queueSize == this->getCapacity() )
+	if( tail - head == queueCapacity )
 	{
-		this->resize( this->getCapacity() * 1.25 );
+		grow();
 	}
 
-	this->operator[]( queueSize ) = enqueueData;
-	queueSize++;
+	queueData[ tail & ( queueCapacity - 1 ) ] = enqueueData;
+	tail++;
 }
 
 template <class DataType>
-bool SimpleQueue<DataType>::dequeue
+void SimpleQueue<DataType>::enqueue
    (
-    DataType &dequeueData 
+    DataType &&enqueueData
    )
 {
-	int index; 
+	if( tail - head == queueCapacity )
+	{
+		grow();
+	}
+
+	queueData[ tail & ( queueCapacity - 1 ) ] = std::move( enqueueData );
+	tail++;
+}
 
+template <class DataType>
+bool SimpleQueue<DataType>::dequeue
+   (
+    DataType &dequeueData
+   )
+{
 	if( !isEmpty() )
 	{
-		queueSize--;
-		dequeueData = this->operator []( 0 );
-
-		for( index = 0; index < queueSize; index++ )
-		{
-			this->operator[]( index ) = this->operator[]( index + 1 );
-		}
+		dequeueData = std::move( queueData[ head & ( queueCapacity - 1 ) ] );
+		head++;
 
 		return true;
 	}
@@ -113,18 +182,59 @@ bool SimpleQueue<DataType>::dequeue
 template <class DataType>
 bool SimpleQueue<DataType>::peekFront
    (
-    DataType &peekData 
-   )
+    DataType &peekData
+   ) const
 {
 	if( !isEmpty() )
 	{
-		peekData = this->operator[]( 0 );
+		peekData = queueData[ head & ( queueCapacity - 1 ) ];
 		return true;
 	}
 
 	return false;
 }
 
+template <class DataType>
+void SimpleQueue<DataType>::clear
+   (
+   	// no parameters
+   )
+{
+	head = 0;
+	tail = 0;
+}
+
+template <class DataType>
+void SimpleQueue<DataType>::grow
+   (
+   	// no parameters
+   )
+{
+	unsigned int newCapacity = queueCapacity * 2;
+	unsigned int index, size = tail - head;
+	DataType *newData;
+
+	if( newCapacity == 0 ) //moved from queue
+	{
+		newCapacity = INITIAL_CAPACITY;
+	}
+
+	newData = new DataType[ newCapacity ];
+
+	for( index = 0; index < size; index++ )
+	{
+		newData[ index ] =
+		           std::move( queueData[ ( head + index ) & ( queueCapacity - 1 ) ] );
+	}
+
+	delete [] queueData;
+
+	queueData = newData;
+	queueCapacity = newCapacity;
+	head = 0;
+	tail = size;
+}
+
 // Terminating precompiler directives  ////////////////////////////////////////
 
 #endif		// #ifndef CLASS_SIMPLEQUEUE_CPP
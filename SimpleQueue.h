@@ -3,15 +3,19 @@
  * @file SimpleQueue.h
  *
  * @brief Definition file for SimpleQueue class
- * 
+ *
  * @author Michael Leverington
- * 
+ *
  * @details Specifies all member methods of the SimpleQueue class
  *
  * @version 1.00
  *          Michael Leverington (13 April 2016)
  *          Original Code
  *
+ * @version 2.00
+ *          Ring buffer with power of two capacity, enqueue and dequeue
+ *          are O(1) and move data instead of copying it
+ *
  * @Note None
  */
 
@@ -25,47 +29,64 @@
 #include <iostream>
 using namespace std;
 
-#include "SimpleList.cpp"
-
 // Class definition  //////////////////////////////////////////////////////////
 
 
 template <class DataType>
-class SimpleQueue : public SimpleList<DataType>
+class SimpleQueue
    {
     public:
 
-    static const int INITIAL_CAPACITY = 10;
+    // must be a power of two
+    static const unsigned int INITIAL_CAPACITY = 16;
 
     // constructors
     SimpleQueue();
-    SimpleQueue( const SimpleQueue &copiedQueue ); 
+    SimpleQueue( const SimpleQueue &copiedQueue );
+    SimpleQueue( SimpleQueue &&movedQueue ) noexcept;
 
     // destructor
     ~SimpleQueue( );
 
     // assignment
     const SimpleQueue &operator = ( const SimpleQueue &rhQueue );
+    const SimpleQueue &operator = ( SimpleQueue &&rhQueue ) noexcept;
 
     // accessors
 
        // reports empty queue
        bool isEmpty() const;
 
+       // reports number of items in queue
+       int getSize() const;
+
     // modifiers
 
        // enqueues data
        void enqueue( const DataType &enqueueData );
+       void enqueue( DataType &&enqueueData );
 
        // dequeues data
        bool dequeue( DataType &dequeueData);
 
        // allows access to front without removal
-       bool peekFront( DataType &peekData );
+       bool peekFront( DataType &peekData ) const;
+
+       // removes all data
+       void clear();
 
     private:
 
-       int queueSize;
+       // doubles capacity, moving data to the front of the new buffer
+       void grow();
+
+       DataType *queueData;
+       unsigned int queueCapacity;
+
+       // running counts of items added and removed,
+       // slot is count & ( queueCapacity - 1 )
+       unsigned int head;
+       unsigned int tail;
 
    };
 
@@ -0,0 +1,1603 @@
+//Simulator.cpp
+//implements Simulator functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMULATOR_CPP
+#define CLASS_SIMULATOR_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdlib.h>
+#include "Simulator.h"
+
+using namespace std;
+
+Simulator::Simulator
+   (
+    // no parameters
+   )
+       : ioCount( 0 ), ProcessCount( 0 ), liveProcesses( 0 ), nextBoost( 0 ),
+         deviceRequests(), deviceBusy(), pageFaults( 0 ), memoryOps( false ),
+         quiet( false ), started( false ), finished( false )
+{
+	// initializers used
+}
+
+Simulator::~Simulator
+   (
+    // no parameters
+   )
+{
+    finish(); //threads of a run still going can't outlive it
+}
+
+int Simulator::run
+   (
+    istream &configText,
+    bool quiet
+   )
+{
+    if( !loadConfig( configText ) )
+    {
+        return 1;
+    }
+
+    //no log to hold the message, report it on the monitor
+    if( !loadWorkload() )
+    {
+        if( !quiet )
+        {
+            cout << loadMessages;
+        }
+        return 1;
+    }
+
+    if( !start( quiet ) )
+    {
+        return 1;
+    }
+
+    finish();
+
+    return 0;
+}
+
+bool Simulator::loadConfig
+   (
+    istream &configText
+   )
+{
+    int index;
+
+    if( !readConfig( configText, config ) )
+    {
+        return false;
+    }
+    
+    for( index = 0; index < DEVICE_LIMIT; index++ ) //names for the log
+    {
+        if( config.devices.isDevice( index ) )
+        {
+            setLogDevice( logDevices, index,
+                          config.devices.get( index ).name,
+                          config.devices.get( index ).label );
+        }
+    }
+
+    return true;
+}
+
+bool Simulator::loadConfig
+   (
+    const string &path
+   )
+{
+    ifstream fin( path.c_str() );
+
+    return loadConfig( fin );
+}
+
+bool Simulator::loadWorkload
+   (
+    // no parameters
+   )
+{
+    return loadWorkload( config.mdf );
+}
+
+bool Simulator::loadWorkload
+   (
+    const string &mdfPath
+   )
+{
+    return readInput( mdfPath, config.devices, program );
+}
+
+bool Simulator::start
+   (
+    bool quietRun
+   )
+{
+    int index, waiting = 0;
+    bool logOpened;
+
+    quiet = quietRun;
+
+    //a binary log file gets its own sink, metadata errors can't go in it
+    //  so they are reported on the monitor
+    if( quiet )
+    {
+        logOpened = logSink.open( false, "" );
+    }
+    else if( config.binaryLog && config.logTo != L_MONITOR )
+    {
+        logOpened = logSink.open( true, "" )
+                    && binarySink.open( false, config.lgf );
+        if( logOpened )
+        {
+            binarySink.write( LOG_BINARY_MAGIC, LOG_BINARY_MAGIC_SIZE );
+            binarySink.write( encodeLogDevices( logDevices ) );
+        }
+    }
+    else
+    {
+        logOpened = logSink.open( config.logTo != L_FILE,
+                                  config.logTo != L_MONITOR ? config.lgf : "" );
+    }
+    
+    if( !logOpened )
+    {
+        cout << "Log file " << config.lgf << " could not be created." << endl;
+        return false;
+    }
+    
+    //problems found loading the workload go ahead of the log
+    logSink.write( loadMessages );
+    
+    liveProcesses = ProcessCount;
+    runQueues.init( config.schedulingAlg, ProcessCount,
+                    config.processorCount, config.mlfqLevels );
+    for( index = 0; index < ProcessCount; index++ ) //deal out to the CPUs
+    {
+        program[index].pageFrame.assign( config.processPages, -1 );
+        program[index].page = program[index].cachePage = 0;
+        program[index].pageSeed = program[index].control.processNum;
+        program[index].pageHand = 0;
+        program[index].core = 0;
+        program[index].index = index;
+        program[index].onCpu = false;
+        program[index].preempted = false;
+        program[index].yielded = false;
+        program[index].control.priority = 0;
+        program[index].metrics.arrival = program[index].arrival;
+        program[index].metrics.firstRun = -1;
+        program[index].metrics.completion = -1;
+        program[index].metrics.waitTime = 0;
+        program[index].metrics.cpuTime = 0;
+        program[index].metrics.ioTime = 0;
+        program[index].metrics.dispatches = 0;
+        program[index].readySince = program[index].ioSince = 0;
+        if( program[index].arrival == 0 )
+        {
+            runQueues.add( index % config.processorCount, index,
+                           readyOrder( program[index], config ), 0 );
+        }
+        else
+        {
+            waiting++; //added by arrivalThread()
+        }
+    }
+    
+    /* Initialize devices */
+    for( index = 0; index < DEVICE_LIMIT; index++ )
+    {
+        if( config.devices.isDevice( index ) )
+        {
+            devicePools[index].init( config.devices.get( index ).units );
+        }
+    }
+    if( config.diskPolicy >= 0 )
+    {
+        disks.init( &simClock, config.devices.get( OP_HARD_DRIVE ).units,
+                    config.diskPolicy, config.diskTracks );
+    }
+    memory.init( config.systemMemory, config.blockSize );
+    cpuBusy.assign( config.processorCount, 0 );
+    tlbs.resize( config.processorCount );
+    for( index = 0; index < config.processorCount; index++ )
+    {
+        tlbs[index].init( config.tlbEntries, config.tlbPolicy );
+    }
+    simClock.initCondition( ioFinished );
+    simClock.initCondition( processReady );
+    
+    simClock.start( config.virtualClock ); //time at beginning of program
+    nextBoost = config.boostInterval * 1000L;
+    if( quiet )
+    {
+        simLog.start( &simClock, &logDevices, NULL );
+    }
+    else if( config.binaryLog && config.logTo != L_MONITOR )
+    {
+        simLog.start( &simClock, &logDevices,
+                      config.logTo == L_BOTH ? &logSink : NULL, &binarySink );
+    }
+    else
+    {
+        simLog.start( &simClock, &logDevices, &logSink );
+    }
+    
+    //one worker per device unit, a request only goes to a worker once it
+    //  holds a unit
+    ioPool.start( &simClock, config.devices.getUnitCount() );
+    
+    if( waiting > 0 )
+    {
+        arrivals.sim = this;
+        arrivals.cfg = &config;
+        arrivals.program = &program;
+        arrivals.core = 0;
+        arrivalPool.start( &simClock, 1 );
+        arrivalPool.submit( arrivalMain, (void*)&arrivals );
+    }
+
+
+    /* Run Simulation */
+    simLog.write( LOG_SIM_START );
+    
+    cores.resize( config.processorCount );
+    cpuPool.start( &simClock, config.processorCount );
+    for( index = 0; index < config.processorCount; index++ )
+    {
+        cores[index].sim = this;
+        cores[index].cfg = &config;
+        cores[index].program = &program;
+        cores[index].core = index;
+        cpuPool.submit( cpuMain, (void*)&cores[index] );
+    }
+    
+    started = true;
+
+    return true;
+}
+
+bool Simulator::step
+   (
+    // no parameters
+   )
+{
+    long next;
+
+    if( !started || finished )
+    {
+        return false;
+    }
+
+    if( !simClock.isVirtual() )
+    {
+        simClock.wait( config.processor * 1000 );
+        return !isFinished();
+    }
+
+    simClock.wait( 0 ); //everything due now runs first
+    simClock.lock();
+    next = simClock.getNextWake();
+    simClock.unlock();
+
+    if( next > simClock.now() )
+    {
+        simClock.wait( next - simClock.now() );
+    }
+
+    return next >= 0 && !isFinished();
+}
+
+bool Simulator::runUntil
+   (
+    long usec
+   )
+{
+    long next;
+
+    if( !started || finished )
+    {
+        return false;
+    }
+
+    //stops early once every process is done, so the run is not stretched
+    while( simClock.now() < usec && !isFinished() )
+    {
+        if( !simClock.isVirtual() )
+        {
+            simClock.wait( min( usec - simClock.now(),
+                                config.processor * 1000LL ) );
+            continue;
+        }
+
+        simClock.wait( 0 );
+        simClock.lock();
+        next = simClock.getNextWake();
+        simClock.unlock();
+
+        if( next < 0 )
+        {
+            break;
+        }
+        if( next > simClock.now() )
+        {
+            simClock.wait( min( next, usec ) - simClock.now() );
+        }
+    }
+
+    return !isFinished();
+}
+
+void Simulator::finish
+   (
+    // no parameters
+   )
+{
+    int index;
+    long tlbHits, tlbMisses, requests;
+
+    if( !started || finished )
+    {
+        return;
+    }
+
+    cpuPool.stop(); //returns once every process has exited
+    arrivalPool.stop();
+    
+    //wait for all threads to finish execution 
+    //output when each process finishes   
+    simClock.lock();
+    logFinished();
+    while( ioCount > 0 )
+    {
+        simClock.block( ioFinished ); //sleep until an I/O request ends
+        logFinished();
+    }
+    simClock.unlock();
+    
+    ioPool.stop();
+    
+    //how much work moved between the CPUs
+    if( config.processorCount > 1 )
+    {
+        for( index = 0; index < config.processorCount; index++ )
+        {
+            simLog.write( LOG_CPU_STEALS, 0, runQueues.getSteals( index ),
+                          index );
+            simLog.write( LOG_CPU_MIGRATIONS, 0,
+                          runQueues.getMigrations( index ), index );
+        }
+    }
+    
+    //average seek distance in hundredths of a track and queue wait in usec
+    for( index = 0; index < disks.getDriveCount(); index++ )
+    {
+        requests = disks.getRequests( index );
+        simLog.write( LOG_DISK_REQUESTS, 0, requests, index );
+        simLog.write( LOG_DISK_SEEK, 0, requests > 0
+                      ? disks.getSeekTotal( index ) * 100 / requests : 0,
+                      index );
+        simLog.write( LOG_DISK_WAIT, 0, requests > 0
+                      ? disks.getWaitTotal( index ) / requests : 0, index );
+    }
+    
+    //memory is only used by M(allocate) and M(free), and by paging
+    if( memoryOps || config.tlbEntries > 0 )
+    {
+        simLog.write( LOG_MEMORY_PEAK, 0, memory.getPeakUsed() );
+        simLog.write( LOG_MEMORY_RUNS, 0, memory.getPeakFreeRuns() );
+        simLog.write( LOG_MEMORY_FAILED, 0, memory.getFailed() );
+    }
+    
+    if( config.tlbEntries > 0 )
+    {
+        tlbHits = tlbMisses = 0;
+        for( index = 0; index < config.processorCount; index++ )
+        {
+            tlbHits += tlbs[index].getHits();
+            tlbMisses += tlbs[index].getMisses();
+        }
+        
+        simLog.write( LOG_TLB_HITS, 0, tlbHits );
+        simLog.write( LOG_TLB_MISSES, 0, tlbMisses );
+        simLog.write( LOG_TLB_HIT_RATE, 0, tlbHits + tlbMisses > 0
+                      ? tlbHits * 10000 / ( tlbHits + tlbMisses ) : 0 );
+        simLog.write( LOG_PAGE_FAULTS, 0, pageFaults );
+    }
+    
+    simClock.lock();
+    fillReport( report, program, config );
+    simClock.unlock();
+    
+    simLog.write( LOG_SIM_END );
+    simLog.stop(); //every line is in the sinks after this
+    
+    //the summary follows the log, on the monitor when the log is binary
+    if( !quiet )
+    {
+        logSink.write( report.formatTable() );
+    }
+    if( !quiet && !config.reportPath.empty()
+            && !report.write( config.reportPath ) )
+    {
+        logSink.write( "Report file " + config.reportPath
+                       + " could not be created.\n" );
+    }
+    logSink.close();
+    binarySink.close();
+
+    /* Destroy conditions */
+    simClock.destroyCondition( ioFinished );
+    simClock.destroyCondition( processReady );
+    
+    finished = true;
+}
+
+long Simulator::now
+   (
+    // no parameters
+   )
+{
+    return started ? simClock.now() : 0;
+}
+
+bool Simulator::isFinished
+   (
+    // no parameters
+   )
+{
+    bool done;
+
+    if( !started || finished )
+    {
+        return finished;
+    }
+
+    simClock.lock();
+    done = ( liveProcesses == 0 && ioCount == 0 );
+    simClock.unlock();
+
+    return done;
+}
+
+RunReport Simulator::getMetrics
+   (
+    // no parameters
+   )
+{
+    RunReport current;
+
+    if( finished )
+    {
+        return report;
+    }
+
+    if( started )
+    {
+        simClock.lock();
+        fillReport( current, program, config );
+        simClock.unlock();
+    }
+
+    return current;
+}
+
+const RunReport &Simulator::getReport
+   (
+    // no parameters
+   ) const
+{
+    return report;
+}
+
+bool Simulator::readConfig( istream& fin, ConfigType& config )
+{
+    string buffer, tmp;
+    DeviceType hardDrive = { "hard drive", "HDD", 1, 0, true, true },
+               keyboard = { "keyboard", "", 1, 0, true, false },
+               monitor = { "monitor", "", 1, 0, false, true },
+               printer = { "printer", "PRNTR", 1, 0, false, true };
+    
+    config.virtualClock = false;
+    config.binaryLog = false;
+    config.processorCount = 1;
+    config.tlbEntries = 0;
+    config.tlbPolicy = TLB_LRU;
+    config.processPages = 4;
+    config.faultCycles = 5;
+    config.diskPolicy = -1;
+    config.diskTracks = 200;
+    config.seekTime = 100;
+    config.mlfqLevels = 3;
+    config.boostInterval = 1000;
+    config.logTo = L_MONITOR;
+    
+    if( fin ) //check if file opened
+    {
+        //get number data from config
+        fin >> buffer;
+        while( buffer.compare("Path:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> config.mdf;
+        
+        fin >> buffer;
+        while( buffer.compare("Number:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        config.quantum = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("Code:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        if( buffer.compare( "RR" ) == 0 )
+        {
+            config.schedulingAlg = 0;
+        }
+        else if( buffer.compare( "SRTF" ) == 0 )
+        {
+            config.schedulingAlg = 1;
+        }
+        else if( buffer.compare( "MLFQ" ) == 0 )
+        {
+            config.schedulingAlg = 3;
+        }
+        else
+        {
+            config.schedulingAlg = 2;
+        }
+        
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        config.processor = atoi(buffer.c_str());
+
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        monitor.cycleTime = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        hardDrive.cycleTime = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        printer.cycleTime = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        keyboard.cycleTime = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("(msec):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        config.memory = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("memory") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        fin >> tmp;
+        if( buffer.compare("(kbytes):") == 0 )
+        {
+            config.systemMemory = atoi(tmp.c_str()); 
+        } 
+        else if( buffer.compare("(Mbytes):") == 0 )
+        {
+            config.systemMemory = atoi(tmp.c_str()) * 1000; 
+        } 
+        else if( buffer.compare("(Gbytes):") == 0 )
+        {
+            config.systemMemory = atoi(tmp.c_str()) * 1000000; 
+        } 
+        
+        fin >> buffer;
+        while( buffer.compare("(kbytes):") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        config.blockSize = atoi(buffer.c_str());
+        
+        fin >> buffer;
+        while( buffer.compare("quantity:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        printer.units = atoi(buffer.c_str());
+
+        fin >> buffer;
+        while( buffer.compare("quantity:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        hardDrive.units = atoi(buffer.c_str());
+        
+        config.devices.set( OP_HARD_DRIVE, hardDrive );
+        config.devices.set( OP_KEYBOARD, keyboard );
+        config.devices.set( OP_MONITOR, monitor );
+        config.devices.set( OP_PRINTER, printer );
+                
+        fin >> buffer;
+        while( buffer.compare("to") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> buffer;
+        
+        //log to both, monitor, or file
+        if( buffer.compare("File") == 0 )
+        {
+            config.logTo = L_FILE;
+        }
+        else if( buffer.compare("Monitor") == 0 )
+        {
+            config.logTo = L_MONITOR;
+        }
+        else
+        {
+            config.logTo = L_BOTH;
+        }
+        
+        fin >> buffer;
+        while( buffer.compare("Path:") != 0 )
+        {
+            fin >> buffer;
+        }
+        
+        fin >> config.lgf;  
+        config.binaryLog = ( config.lgf.size() > 4 && config.lgf.compare(
+                                 config.lgf.size() - 4, 4, ".bin" ) == 0 );
+        
+        //optional settings, one per line until the end marker
+        getline( fin, buffer ); //rest of the log file path line
+        while( getline( fin, buffer ) && buffer.compare( 0, 3, "End" ) != 0 )
+        {
+            readOption( buffer, config );
+        }
+        
+        //one quantum per MLFQ level, doubling past the ones given
+        config.levelQuantum.resize( min( (int)config.levelQuantum.size(),
+                                         config.mlfqLevels ) );
+        while( (int)config.levelQuantum.size() < config.mlfqLevels )
+        {
+            config.levelQuantum.push_back( config.levelQuantum.empty()
+                                           ? config.quantum
+                                           : 2 * config.levelQuantum.back() );
+        }
+    }
+    
+    else
+    {
+        //no log settings to follow, report it on the monitor
+        cout << "No configuration file found." << endl;
+        return false;
+    }
+    
+    return true;
+}
+    
+void Simulator::readOption( const string& line, ConfigType& config )
+{
+    istringstream fields;
+    string key, value, text;
+    size_t colon = line.find( ':' );
+    
+    if( colon == string::npos ) //not a setting
+    {
+        return;
+    }
+    
+    key = line.substr( 0, colon );
+    value = line.substr( colon + 1 );
+    value.erase( 0, value.find_first_not_of( " \t" ) ); //trim spaces
+    value.erase( value.find_last_not_of( " \t\r" ) + 1 );
+    
+    if( key.compare( "Simulation clock" ) == 0 )
+    {
+        config.virtualClock = ( value.compare( "Virtual" ) == 0 );
+    }
+    else if( key.compare( "Log format" ) == 0 )
+    {
+        config.binaryLog = ( value.compare( "Binary" ) == 0 );
+    }
+    else if( key.compare( "Processor count" ) == 0 )
+    {
+        config.processorCount = max( 1, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "Device" ) == 0 )
+    {
+        readDevice( value, config );
+    }
+    else if( key.compare( "TLB entries" ) == 0 )
+    {
+        config.tlbEntries = max( 0, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "TLB replacement" ) == 0 )
+    {
+        config.tlbPolicy = ( value.compare( "CLOCK" ) == 0 ) ? TLB_CLOCK
+                                                             : TLB_LRU;
+    }
+    else if( key.compare( "Process pages" ) == 0 )
+    {
+        config.processPages = max( 1, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "Page fault cycles" ) == 0 )
+    {
+        config.faultCycles = max( 0, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "Disk scheduling" ) == 0 )
+    {
+        if( value.compare( "SSTF" ) == 0 )
+        {
+            config.diskPolicy = DISK_SSTF;
+        }
+        else if( value.compare( "SCAN" ) == 0 )
+        {
+            config.diskPolicy = DISK_SCAN;
+        }
+        else if( value.compare( "C-LOOK" ) == 0 )
+        {
+            config.diskPolicy = DISK_CLOOK;
+        }
+        else
+        {
+            config.diskPolicy = DISK_FCFS;
+        }
+    }
+    else if( key.compare( "Disk tracks" ) == 0 )
+    {
+        config.diskTracks = max( 1, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "Track seek time" ) == 0 )
+    {
+        config.seekTime = max( 0, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "MLFQ levels" ) == 0 )
+    {
+        config.mlfqLevels = max( 1, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "MLFQ quanta" ) == 0 )
+    {
+        fields.str( value );
+        config.levelQuantum.clear();
+        while( getline( fields, text, ',' ) )
+        {
+            config.levelQuantum.push_back( max( 1, atoi( text.c_str() ) ) );
+        }
+    }
+    else if( key.compare( "MLFQ boost interval (msec)" ) == 0 )
+    {
+        config.boostInterval = max( 0, atoi( value.c_str() ) );
+    }
+    else if( key.compare( "Report file path" ) == 0 )
+    {
+        config.reportPath = value;
+    }
+}
+    
+void Simulator::readDevice( const string& value, ConfigType& config )
+{
+    istringstream fields( value );
+    vector<string> field;
+    string text;
+    DeviceType type;
+    
+    //name, units, cycle time, directions, and an optional label
+    while( getline( fields, text, ',' ) )
+    {
+        text.erase( 0, text.find_first_not_of( " \t" ) );
+        text.erase( text.find_last_not_of( " \t\r" ) + 1 );
+        field.push_back( text );
+    }
+    
+    if( field.size() < 4 || field[0].empty() )
+    {
+        return;
+    }
+    
+    type.name = field[0];
+    type.units = max( 1, atoi( field[1].c_str() ) );
+    type.cycleTime = max( 0, atoi( field[2].c_str() ) );
+    type.input = ( field[3].find( 'I' ) != string::npos );
+    type.output = ( field[3].find( 'O' ) != string::npos );
+    type.label = ( field.size() > 4 ) ? field[4] : "";
+    
+    config.devices.add( type );
+}
+    
+bool Simulator::readInput( const string mdf, const DeviceRegistry& devices,
+                           vector<Process>& processList )
+{
+    MetaDataParser parser;
+    Process* ptmp = new Process;
+    MetaDataType mdtmp;
+    ostringstream message;
+    int status;
+    bool appEnd, opened;
+    
+    opened = parser.open( mdf, devices );
+    if( opened ) //check if file opened
+    {
+        ptmp->timeRemaining = 0;
+        ptmp->control.state = NEW;
+        ptmp->current.cycles = 0;
+        ptmp->arrival = 0;
+        while( ( status = parser.next( mdtmp ) ) != PARSE_END )
+        {
+            if( status == PARSE_ERROR )
+            {
+                message.str( "" );
+                message << "Malformed metadata entry on line "
+                        << parser.getEntryLine() << ": "
+                        << parser.getEntryText() << endl;
+                loadMessages += message.str();
+                continue;
+            }
+            
+            appEnd = ( mdtmp.operation == OP_END && mdtmp.code == 'A' );
+            if( mdtmp.operation == OP_ALLOCATE || mdtmp.operation == OP_FREE )
+            {
+                memoryOps = true;
+            }
+            if( mdtmp.operation == OP_START && mdtmp.code == 'A'
+                    && mdtmp.at > 0 )
+            {
+                ptmp->arrival = mdtmp.at * 1000L;
+            }
+            ptmp->timeRemaining += mdtmp.cycles;
+            ptmp->metaData.enqueue( std::move( mdtmp ) ); //push data to queue
+            
+            if( appEnd )
+            {
+                ProcessCount++;
+                ptmp->control.processNum = ProcessCount;
+                ptmp->jobLength = ptmp->timeRemaining;
+                ptmp->cacheCount = 0;
+                ptmp->runningThreads = 0;
+                processList.push_back( std::move( *ptmp ) );
+                delete ptmp;
+                ptmp = new Process;
+                ptmp->timeRemaining = 0;
+                ptmp->control.state = NEW;
+                ptmp->current.cycles = 0;
+                ptmp->arrival = 0;
+            }
+        }
+    }
+    
+    else
+    {
+        loadMessages += "No metadata file found.\n";
+    }
+    
+    delete ptmp;
+    ptmp = NULL;
+    
+    return opened;
+}
+
+int Simulator::runOperation( Process& running, const ConfigType& cfg,
+                             int cycle )
+{
+    PCB* control = &(running.control);
+    MetaDataType* runMeta = &(running.current);
+    ThreadArg* args;
+    unsigned int address;
+    int extra;
+    bool done, dispatched = true;
+
+    //only S and A operations start or end
+    if( runMeta->operation == OP_START )
+    {
+        //Operating System ready, Program Application running
+        control->state = ( runMeta->code == 'S' ) ? READY : RUNNING;
+    }
+    else if( runMeta->operation == OP_END )
+    {
+        simClock.lock();
+        control->state = EXIT;
+        running.yielded = true;
+        liveProcesses--;
+        while( running.blocks.dequeue( address ) ) //give back its memory
+        {
+            memory.release( address );
+        }
+        unloadPages( running );
+        if( running.runningThreads == 0 )
+        {
+            processFinished( &running );
+        }
+        simClock.unlock();
+    }
+    
+    while( runMeta->cycles > 0 && cycle < running.quantum
+                               && !running.preempted )
+    {        
+        switch( runMeta->operation )
+        {
+        case OP_RUN: //Process
+            if( !runMeta->started )
+            {
+                simLog.write( LOG_RUN_START, control->processNum );
+                runMeta->started = true;
+            }
+            
+            if( cfg.tlbEntries > 0 ) //every cycle reads a page
+            {
+                extra = touchPage( running, nextPage( running, cfg ), cfg );
+                if( extra > 0 )
+                {
+                    simClock.wait( extra * cfg.memory * 1000 );
+                }
+            }
+            
+            simClock.wait( cfg.processor * 1000 ); //wait one cycle
+            runMeta->cycles--;
+            
+            if( runMeta->cycles == 0 )
+            {
+                simLog.write( LOG_RUN_END, control->processNum );
+            }
+            else if( cycle == running.quantum - 1
+                     || preempt( running, cycle, cfg ) )
+            {
+                simLog.write( LOG_RUN_INTERRUPT, control->processNum );
+            }
+            break;
+        
+        case OP_ALLOCATE: //Memory
+            if( !runMeta->started )
+            {
+                simLog.write( LOG_ALLOCATE_START, control->processNum );
+                runMeta->started = true;
+            }
+            
+            simClock.wait( cfg.memory * 1000 ); //wait one cycle
+            runMeta->cycles--;
+            
+            if( runMeta->cycles == 0 )
+            {
+                simClock.lock(); //memory is shared by every CPU
+                done = memory.allocate( address );
+                if( done )
+                {
+                    running.blocks.enqueue( address );
+                }
+                simClock.unlock();
+                
+                if( done )
+                {
+                    simLog.write( LOG_ALLOCATE_END, control->processNum,
+                                  address );
+                }
+                else
+                {
+                    simLog.write( LOG_ALLOCATE_FAILED, control->processNum );
+                }
+            }
+            else if( cycle == running.quantum - 1
+                     || preempt( running, cycle, cfg ) )
+            {
+                simLog.write( LOG_ALLOCATE_INTERRUPT, control->processNum );
+            }
+            break;
+            
+        case OP_FREE: //Memory
+            if( !runMeta->started )
+            {
+                simLog.write( LOG_FREE_START, control->processNum );
+                runMeta->started = true;
+            }
+            
+            simClock.wait( cfg.memory * 1000 ); //wait one cycle
+            runMeta->cycles--;
+            
+            if( runMeta->cycles == 0 )
+            {
+                simClock.lock();
+                done = running.blocks.dequeue( address );
+                if( done )
+                {
+                    memory.release( address );
+                }
+                simClock.unlock();
+                
+                if( done )
+                {
+                    simLog.write( LOG_FREE_END, control->processNum, address );
+                }
+                else
+                {
+                    simLog.write( LOG_FREE_EMPTY, control->processNum );
+                }
+            }
+            else if( cycle == running.quantum - 1
+                     || preempt( running, cycle, cfg ) )
+            {
+                simLog.write( LOG_FREE_INTERRUPT, control->processNum );
+            }
+            break;
+            
+        case OP_CACHE: //Memory
+            if( !runMeta->started )
+            {
+                simLog.write( LOG_CACHE_START, control->processNum );
+                runMeta->started = true;
+            }
+            
+            simClock.wait( cfg.memory * 1000 ); //wait one cycle
+            if( cfg.tlbEntries > 0 ) //load the next page ahead of use
+            {
+                extra = touchPage( running,
+                                   running.cachePage++ % cfg.processPages, cfg );
+                if( extra > 0 )
+                {
+                    simClock.wait( extra * cfg.memory * 1000 );
+                }
+            }
+            runMeta->cycles--;
+                   
+            if( runMeta->cycles == 0 )
+            {
+                simLog.write( LOG_CACHE_END, control->processNum );
+                running.cacheCount++; //increment number of cache operations
+                
+            }
+            else if( cycle == running.quantum - 1
+                     || preempt( running, cycle, cfg ) )
+            {
+                simLog.write( LOG_CACHE_INTERRUPT, control->processNum );
+            }
+            break;
+        
+        default: //I/O in thread, the parser only lets known devices through
+            args = new ThreadArg;
+            args->sim = this;
+            args->cfg = &cfg;
+            args->meta = *runMeta;
+            args->control = *control;
+            args->running = &running;
+            args->unit = -1;
+            args->distance = 0;
+            
+            simClock.lock();
+            ioCount++;
+            running.runningThreads++;
+            control->state = WAITING; //until endIo() makes it READY
+            running.yielded = true;
+            running.ioSince = simClock.now();
+            //queued on the device while its units are busy, or on a drive
+            //  until the drive picks it
+            if( runMeta->operation == OP_HARD_DRIVE && cfg.diskPolicy >= 0 )
+            {
+                dispatched = disks.request( args, runMeta->at, args->unit,
+                                            args->distance );
+            }
+            else
+            {
+                dispatched = devicePools[runMeta->operation].request(
+                                 args, args->unit );
+            }
+            simClock.unlock();
+            
+            if( dispatched )
+            {
+                ioPool.submit( ioMain, (void*)args ); //args freed by worker
+            }
+            
+            //the device does the work, the CPU is free for another process
+            running.timeRemaining -= runMeta->cycles;
+            runMeta->cycles = 0;
+            return cycle;
+        }
+        
+        cycle++;
+    }
+    
+    return cycle; //number of cycles completed
+}
+
+void Simulator::runProcess( Process& running, const ConfigType& cfg )
+{
+    bool dequeued = true;
+    int cyclesRun = 0;
+    int updateCycles; //if a cache operation has occurred, change run cycle num
+    
+    //endIo() can change the state under the lock while this runs
+    while( cyclesRun < running.quantum && !running.yielded
+                                       && !running.preempted )
+    {
+        if( running.current.cycles <= 0 || running.current.code == 'I'
+                                || running.current.code == 'O' )
+        {
+            dequeued = running.metaData.dequeue( running.current ); //get process to run
+            //update cycles for processor
+            //if caching operation has occurred
+            if( running.current.operation == OP_RUN && cfg.tlbEntries == 0 )
+            {
+                updateCycles = max( 1, running.current.cycles - 2 * running.cacheCount );
+                //update time left in process
+                running.timeRemaining -= ( running.current.cycles - updateCycles );
+                running.current.cycles = updateCycles;
+            }    
+        }
+    
+        if( dequeued )
+        {
+            cyclesRun = runOperation( running, cfg, cyclesRun );   
+        }
+    }
+    
+    running.timeRemaining -= cyclesRun; 
+}
+
+bool Simulator::preempt( Process& running, int cycle, const ConfigType& cfg )
+{
+    int next;
+    
+    if( cfg.schedulingAlg != SRTF && cfg.schedulingAlg != MLFQ )
+    {
+        return false;
+    }
+    
+    simClock.lock();
+    next = runQueues.getNextKey( running.core );
+    if( cfg.schedulingAlg == SRTF ) //time left once this cycle is counted
+    {
+        running.preempted = ( next >= 0
+                              && next < running.timeRemaining - cycle - 1 );
+    }
+    else //a higher level is ready
+    {
+        running.preempted = ( next >= 0 && next < running.control.priority );
+    }
+    simClock.unlock();
+    
+    return running.preempted;
+}
+
+int Simulator::readyOrder( const Process& running, const ConfigType& cfg )
+{
+    return ( cfg.schedulingAlg == SJF ) ? running.jobLength
+                                        : running.timeRemaining;
+}
+
+void Simulator::boostPriorities( vector<Process>& program,
+                                 const ConfigType& cfg )
+{
+    unsigned int index;
+    
+    for( index = 0; index < program.size(); index++ )
+    {
+        program[index].control.priority = 0;
+    }
+    runQueues.boost();
+    
+    while( nextBoost <= simClock.now() )
+    {
+        nextBoost += cfg.boostInterval * 1000L;
+    }
+    
+    simLog.write( LOG_OS_BOOST );
+}
+
+int Simulator::nextPage( Process& running, const ConfigType& cfg )
+{
+    running.pageSeed = running.pageSeed * 1103515245 + 12345;
+    if( ( running.pageSeed >> 16 ) % 4 == 0 )
+    {
+        running.page = ( running.pageSeed >> 18 ) % cfg.processPages;
+    }
+    
+    return running.page;
+}
+
+int Simulator::touchPage( Process& running, int page, const ConfigType& cfg )
+{
+    Tlb& tlb = tlbs[running.core];
+    int processNum = running.control.processNum;
+    int cost = 0, other, index;
+    unsigned int address, core;
+    bool fault = false, loaded = true;
+    
+    simClock.lock();
+    if( !tlb.lookup( processNum, page ) )
+    {
+        cost = 1; //read the page table
+        if( running.pageFrame[page] < 0 )
+        {
+            fault = true;
+            pageFaults++;
+            cost += cfg.faultCycles;
+            
+            if( memory.allocate( address ) )
+            {
+                running.pageFrame[page] = address;
+            }
+            else
+            {
+                //memory is full, give up another loaded page of this process
+                loaded = false;
+                for( index = 0; index < cfg.processPages && !loaded; index++ )
+                {
+                    other = running.pageHand;
+                    running.pageHand = ( running.pageHand + 1 )
+                                       % cfg.processPages;
+                    if( other != page && running.pageFrame[other] >= 0 )
+                    {
+                        running.pageFrame[page] = running.pageFrame[other];
+                        running.pageFrame[other] = -1;
+                        for( core = 0; core < tlbs.size(); core++ )
+                        {
+                            tlbs[core].invalidate( processNum, other );
+                        }
+                        loaded = true;
+                    }
+                }
+            }
+        }
+        
+        if( loaded )
+        {
+            tlb.insert( processNum, page );
+        }
+    }
+    simClock.unlock();
+    
+    if( fault )
+    {
+        simLog.write( LOG_PAGE_FAULT, processNum, page );
+    }
+    if( !loaded )
+    {
+        simLog.write( LOG_ALLOCATE_FAILED, processNum );
+    }
+    
+    return cost;
+}
+
+void Simulator::unloadPages( Process& running )
+{
+    unsigned int page, core;
+    
+    for( page = 0; page < running.pageFrame.size(); page++ )
+    {
+        if( running.pageFrame[page] >= 0 )
+        {
+            memory.release( running.pageFrame[page] );
+            running.pageFrame[page] = -1;
+            for( core = 0; core < tlbs.size(); core++ )
+            {
+                tlbs[core].invalidate( running.control.processNum, page );
+            }
+        }
+    }
+}
+
+void Simulator::processFinished( Process* process )
+{
+    process->metrics.completion = simClock.now();
+    finishedProcesses.enqueue( process );
+}
+
+void Simulator::logFinished()
+{
+    Process* process;
+    
+    while( finishedProcesses.dequeue( process ) )
+    {
+        simLog.write( LOG_OS_COMPLETED, process->control.processNum );
+    }
+}
+
+void Simulator::cpuMain( void* arg )
+{
+    ((CoreArg*)arg)->sim->cpuThread( (CoreArg*)arg );
+}
+
+void Simulator::cpuThread( CoreArg* arg )
+{
+    const ConfigType& cfg = *arg->cfg;
+    vector<Process>& program = *arg->program;
+    int core = arg->core;
+    int index;
+    long started;
+    bool migrated;
+    
+    //name the core in the log only when there is more than one
+    if( cfg.processorCount > 1 )
+    {
+        simLog.setCore( core + 1 );
+    }
+    
+    simClock.lock();
+    while( true )
+    {
+        while( runQueues.isEmpty() && liveProcesses > 0 )
+        {
+            simClock.block( processReady );
+        }
+        
+        if( liveProcesses == 0 )
+        {
+            break;
+        }
+        
+        if( cfg.schedulingAlg == MLFQ && cfg.boostInterval > 0
+                && simClock.now() >= nextBoost )
+        {
+            boostPriorities( program, cfg );
+        }
+        
+        index = runQueues.take( core, migrated );
+        started = simClock.now();
+        program[index].metrics.waitTime += started
+                                           - program[index].readySince;
+        if( program[index].metrics.firstRun < 0 )
+        {
+            program[index].metrics.firstRun = started;
+        }
+        program[index].metrics.dispatches++;
+        program[index].core = core;
+        program[index].onCpu = true;
+        program[index].preempted = false;
+        program[index].yielded = false;
+        program[index].quantum = ( cfg.schedulingAlg == MLFQ )
+                ? cfg.levelQuantum[program[index].control.priority]
+                : cfg.quantum;
+        if( program[index].control.state == READY )
+        {
+            program[index].control.state = RUNNING;
+        }
+        if( migrated )
+        {
+            program[index].cacheCount = 0; //cached on the other CPU
+        }
+        simClock.unlock();
+        
+        simLog.write( LOG_OS_PREPARING, program[index].control.processNum );
+        simLog.write( LOG_OS_STARTING, program[index].control.processNum );
+        
+        //run a single process subject to quantum limit
+        runProcess( program[index], cfg );
+        
+        simClock.lock();
+        program[index].onCpu = false;
+        program[index].metrics.cpuTime += simClock.now() - started;
+        cpuBusy[core] += simClock.now() - started;
+        //one waiting for I/O is put back by endIo()
+        if( program[index].control.state != EXIT
+                && program[index].control.state != WAITING )
+        {
+            program[index].control.state = READY;
+            if( cfg.schedulingAlg == MLFQ && !program[index].preempted )
+            {
+                //used its whole quantum, down a level
+                program[index].control.priority = min(
+                        program[index].control.priority + 1,
+                        cfg.mlfqLevels - 1 );
+            }
+            program[index].readySince = simClock.now();
+            runQueues.add( core, index, readyOrder( program[index], cfg ),
+                           program[index].control.priority );
+            simClock.notify( processReady );
+        }
+        else if( liveProcesses == 0 )
+        {
+            simClock.notify( processReady ); //let idle CPUs return
+        }
+        
+        //output processes that have finished execution
+        logFinished();
+    }
+    simClock.unlock();
+}
+
+void Simulator::fillReport( RunReport& report, const vector<Process>& program,
+                            const ConfigType& cfg )
+{
+    DeviceMetrics device;
+    unsigned int index;
+    
+    report.setElapsed( simClock.now() );
+    for( index = 0; index < cpuBusy.size(); index++ )
+    {
+        report.addCpu( cpuBusy[index] );
+    }
+    for( index = 0; index < program.size(); index++ )
+    {
+        report.addProcess( program[index].control.processNum,
+                           program[index].metrics );
+    }
+    for( index = 0; index < DEVICE_LIMIT; index++ )
+    {
+        if( cfg.devices.isDevice( index ) && deviceRequests[index] > 0 )
+        {
+            device.name = cfg.devices.get( index ).name;
+            device.units = cfg.devices.get( index ).units;
+            device.requests = deviceRequests[index];
+            device.busyTime = deviceBusy[index];
+            report.addDevice( device );
+        }
+    }
+}
+
+void Simulator::arrivalMain( void* arg )
+{
+    ((CoreArg*)arg)->sim->arrivalThread( (CoreArg*)arg );
+}
+
+void Simulator::arrivalThread( CoreArg* arg )
+{
+    const ConfigType& cfg = *arg->cfg;
+    vector<Process>& program = *arg->program;
+    vector< pair<long, int> > order; //arrival time and index
+    unsigned int next;
+    int index;
+    long wait;
+    
+    for( index = 0; index < ProcessCount; index++ )
+    {
+        if( program[index].arrival > 0 )
+        {
+            order.push_back( make_pair( program[index].arrival, index ) );
+        }
+    }
+    sort( order.begin(), order.end() ); //ties in process order
+    
+    for( next = 0; next < order.size(); next++ )
+    {
+        index = order[next].second;
+        wait = order[next].first - simClock.now();
+        if( wait > 0 )
+        {
+            simClock.wait( wait );
+        }
+        
+        simLog.write( LOG_OS_ARRIVED, program[index].control.processNum );
+        
+        simClock.lock();
+        program[index].readySince = simClock.now();
+        runQueues.add( index % cfg.processorCount, index,
+                       readyOrder( program[index], cfg ),
+                       program[index].control.priority );
+        simClock.notify( processReady );
+        simClock.unlock();
+    }
+}
+
+void Simulator::ioMain( void* arg )
+{
+    ((ThreadArg*)arg)->sim->ioThread( (ThreadArg*)arg );
+}
+
+void Simulator::ioThread( ThreadArg* arg )
+{
+    const ConfigType& cfg = *arg->cfg;
+    MetaDataType meta = arg->meta;
+    Process* running = arg->running;
+    PCB control = arg->control;
+    DevicePool& devices = devicePools[meta.operation];
+    ThreadArg* next = NULL;
+    int cycleTime = cfg.devices.get( meta.operation ).cycleTime;
+    int unit = arg->unit, distance = arg->distance, nextDistance = 0;
+    long busy;
+    bool input = ( meta.code == 'I' );
+    bool scheduled = ( meta.operation == OP_HARD_DRIVE
+                       && cfg.diskPolicy >= 0 );
+
+    simLog.write( input ? LOG_INPUT_START : LOG_OUTPUT_START,
+                  control.processNum, unit, meta.operation );
+    busy = distance * cfg.seekTime + cycleTime * meta.cycles * 1000L;
+    simClock.wait( busy );
+    
+    simLog.write( input ? LOG_INPUT_END : LOG_OUTPUT_END,
+                  control.processNum, unit, meta.operation );
+    
+    endIo( running, meta.operation, busy );
+    
+    //the unit goes to the next request queued on the device, a drive
+    //  picks its next request by the policy
+    simClock.lock();
+    next = scheduled ? (ThreadArg*)disks.release( unit, nextDistance )
+                     : (ThreadArg*)devices.release( unit );
+    simClock.unlock();
+    
+    if( next != NULL )
+    {
+        next->unit = unit;
+        next->distance = nextDistance;
+        ioPool.submit( ioMain, (void*)next );
+    }
+    
+    delete arg;
+}
+
+void Simulator::endIo( Process* running, unsigned char operation, long busy )
+{
+    simClock.lock();
+    ioCount--;
+    deviceRequests[operation]++;
+    deviceBusy[operation] += busy;
+    running->runningThreads--;
+    if( running->runningThreads == 0 && running->control.state == EXIT )
+    {
+        processFinished( running );
+    }
+    else if( running->runningThreads == 0
+             && running->control.state == WAITING )
+    {
+        running->control.state = READY;
+        running->metrics.ioTime += simClock.now() - running->ioSince;
+        running->readySince = simClock.now();
+        if( !running->onCpu )
+        {
+            runQueues.add( running->core, running->index,
+                           readyOrder( *running, config ),
+                           running->control.priority );
+            simClock.notify( processReady );
+        }
+    }
+    simClock.notify( ioFinished );
+    simClock.unlock();
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMULATOR_CPP
@@ -0,0 +1,478 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file Simulator.h
+ *
+ * @brief Definition file for Simulator class
+ *
+ * @details Specifies one run of the operating system simulation. Everything
+ *          a run uses, the clock, CPUs, run queues, devices, memory, TLBs
+ *          and log, belongs to its Simulator, so several simulators can run
+ *          in one program at the same time, each on its own threads. A run
+ *          loads a config and a workload, starts, and then either runs to
+ *          the end with finish() or is driven forward by step() and
+ *          runUntil(), reading getMetrics() in between. The thread driving
+ *          it takes part in the simulation clock, so with virtual time the
+ *          simulation stands still between calls. A quiet run logs and
+ *          prints nothing and only keeps the report, for programs that
+ *          compare many runs. Sim04 and simbatch are built on this class
+ *          through the libsim.a library.
+ *
+ * @Note Each Simulator runs once, driven by one thread
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_SIMULATOR_H
+#define CLASS_SIMULATOR_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <istream>
+#include <string>
+#include <vector>
+#include "SimpleQueue.cpp"
+#include "SimClock.h"
+#include "MetaData.h"
+#include "ThreadPool.h"
+#include "SimLog.h"
+#include "LogSink.h"
+#include "LogFormat.h"
+#include "RunQueues.h"
+#include "MemoryManager.h"
+#include "Tlb.h"
+#include "DevicePool.h"
+#include "DeviceRegistry.h"
+#include "DiskScheduler.h"
+#include "RunReport.h"
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//PCB states
+static const int NEW = 0,
+                 READY = 1,
+                 RUNNING = 2,
+                 WAITING = 3,
+                 EXIT = 4;
+
+//logTo identifiers
+static const char L_FILE = 'f',
+                  L_MONITOR = 'm',
+                  L_BOTH = 'b';
+
+// Structure definitions //////////////////////////////////////////////////////
+
+class Simulator;
+
+//holds configuration file data
+struct ConfigType
+{
+    string mdf;    //metadata filepath
+    string lgf;    //log filepath
+    int quantum;
+    int schedulingAlg; // RR = 0, SRTF = 1, SJF = 2, MLFQ = 3
+    int processor;
+    int memory;
+    long int systemMemory;
+    int blockSize;
+    DeviceRegistry devices; //I/O devices by operation identifier
+    char logTo;     //L_FILE = 'f', L_MONITOR = 'm', L_BOTH = 'b'
+    bool virtualClock; //simulate with virtual time instead of wall clock
+    bool binaryLog; //log file holds binary records instead of text
+    int processorCount; //simulated CPUs
+    int tlbEntries; //0 when paging is not simulated
+    int tlbPolicy; //TLB_LRU or TLB_CLOCK
+    int processPages; //virtual pages of each process
+    int faultCycles; //memory cycles to load a page
+    int diskPolicy; //DISK_FCFS, ..., -1 when disks are not scheduled
+    int diskTracks; //tracks on each hard drive
+    int seekTime; //usec to move the head one track
+    int mlfqLevels; //MLFQ priority levels
+    vector<int> levelQuantum; //quantum of each MLFQ level
+    int boostInterval; //msec between MLFQ priority boosts, 0 for none
+    string reportPath; //performance report file, empty for none
+};
+
+//process control block
+struct PCB
+{
+    int state; //NEW = 0, READY = 1, RUNNING = 2, WAITING = 3, EXIT = 4
+    int processNum; //process number
+    int priority; //MLFQ level, 0 is the highest
+};
+
+//holds an entire process
+struct Process
+{
+    PCB control;
+    int cacheCount; //number of caching operations completed
+    SimpleQueue<MetaDataType> metaData; //queue of metadata for process
+    MetaDataType current; //metaData currently in use
+    int timeRemaining; //cycles left until complete
+    int jobLength; //cycles of the whole job as loaded, what SJF orders by
+    int runningThreads; //number of I/O requests running for this process
+    SimpleQueue<unsigned int> blocks; //memory it holds, oldest first
+    vector<int> pageFrame; //address of each virtual page, -1 if not loaded
+    int page; //page processing is reading
+    unsigned int pageSeed; //picks the pages processing reads
+    int cachePage; //page the next caching cycle loads
+    int pageHand; //where to look for a page to give up when memory is full
+    int core; //CPU running it
+    int index; //position in the process list
+    bool onCpu; //taken by a CPU and not yet put back
+    long arrival; //usec into the simulation it is admitted
+    bool preempted; //stopped for a process with less time left
+    bool yielded; //gave up its CPU for I/O or to exit, only its CPU uses it
+    int quantum; //cycles it may run each time it is taken
+    ProcessMetrics metrics; //time in each state, for the report
+    long readySince; //usec it last went in a run queue
+    long ioSince; //usec it last started WAITING
+};
+
+//holds arguments to cpuThread() method, one per simulated CPU
+//  and to arrivalThread()
+struct CoreArg
+{
+    Simulator* sim;
+    const ConfigType* cfg;
+    vector<Process>* program;
+    int core;
+};
+
+//holds arguments to ioThread() method
+//allocated by runOperation(), freed by ioThread()
+struct ThreadArg
+{
+    Simulator* sim;
+    const ConfigType* cfg;
+    MetaDataType meta;
+    PCB control;
+    Process* running; //reference to calling process
+    int unit; //device unit it holds, set before it goes to a worker
+    int distance; //tracks the head of its hard drive moved to it
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class Simulator
+   {
+    public:
+
+    // constructors
+    Simulator();
+
+    // destructor, finishes a run that was started
+    ~Simulator();
+
+    // modifiers
+
+       // loads the config, then the metadata it names, and runs it to the
+       //   end with start() and finish()
+       // returns 0, or 1 if the config or the metadata file can't be
+       //   read or the log file can't be created, nothing is run then
+       int run( istream &configText, bool quiet = false );
+
+       // reads the config from a stream or a file
+       // returns false if there is no config to read
+       bool loadConfig( istream &configText );
+       bool loadConfig( const string &path );
+
+       // reads the processes of the metadata file the config names, or
+       //   of another one, malformed entries are reported once the log
+       //   is open
+       // load one workload, after the config
+       // returns false if the file can't be opened
+       bool loadWorkload();
+       bool loadWorkload( const string &mdfPath );
+
+       // opens the log, starts the clock and every simulated CPU and
+       //   device, and logs the start of the simulation
+       // a quiet run leaves out the log, the summary and the report file
+       //   and only keeps the report
+       // returns false if the log file can't be created
+       bool start( bool quietRun = false );
+
+       // runs everything due at the next point in simulated time anything
+       //   is due, in wall clock mode waits one processor cycle
+       // returns false once every process has exited and its I/O is done
+       bool step();
+
+       // runs until usec of simulated time have passed or every process is
+       //   done, whichever is first
+       // returns false once every process is done
+       bool runUntil( long usec );
+
+       // runs the rest of the simulation, then logs the totals and writes
+       //   the performance summary where the config says
+       void finish();
+
+    // accessors
+
+       // usec of simulated time since start()
+       long now();
+
+       // true once every process has exited and its I/O is done
+       bool isFinished();
+
+       // the performance report as of now, times of a process on a CPU
+       //   count up to when it was last taken
+       RunReport getMetrics();
+
+       // the performance report of the finished run
+       const RunReport &getReport() const;
+
+    private:
+
+       //takes as input config file stream and ConfigType object
+       //reads configuration file
+       //into ConfigType object
+       //returns false if the stream could not be read
+       bool readConfig( istream&, ConfigType& );
+
+       //takes as input one "key: value" line from the end of the config
+       //  file and ConfigType object
+       //stores optional settings that follow the log file path
+       void readOption( const string&, ConfigType& );
+
+       //takes as input the value of a "Device:" line and ConfigType object
+       //adds the device it describes, or changes the one with its name
+       //ignores it if a field is missing
+       void readDevice( const string&, ConfigType& );
+
+       //takes metadata file name, the known devices,
+       //and queue of metadata objects as input
+       //reads metadata input
+       //into metadatatype queue
+       //keeps malformed entries for the log and skips them
+       //returns false if the file could not be opened
+       bool readInput( const string, const DeviceRegistry&,
+                       vector<Process>& );
+
+       //takes process, config data object, and the
+       //  number of cycles already completed by the calling process as
+       //  arguments
+       //runs a single metadata function until function terminates
+       //  or quantum limit is reached
+       //interrupts when limit is reached
+       //logs time at beginning, interruption, and end of each metadata
+       //  function
+       //M(free) frees the oldest memory block the process holds,
+       //  every block it holds is freed when it ends
+       //calculates time to wait for cycle, waits for simulated duration
+       //hands I/O operations to ioThread() once a unit of the device is
+       //  free, queues them on the device or its drive until then, and
+       //  puts the process in WAITING, returning so the CPU can run
+       //  another process
+       //returns the number of cycles that have been run
+       int runOperation( Process&, const ConfigType&, int );
+
+       //takes process, the cycles it has run this quantum, and config
+       //  object as arguments
+       //with SRTF, checks at the end of a cycle whether the next process of
+       //  its CPU has less time left, and marks it preempted if so
+       //returns true if it is preempted
+       bool preempt( Process&, int, const ConfigType& );
+
+       //takes process and config object as arguments
+       //returns what orders the process in a run queue, the length of its
+       //  job for SJF and the time it has left otherwise
+       int readyOrder( const Process&, const ConfigType& );
+
+       //takes the process list and config object as arguments
+       //puts every process back on the highest MLFQ level, ready ones at
+       //  the back of its queue in level order, and sets when the next
+       //  boost is due
+       //clock lock must be held
+       void boostPriorities( vector<Process>&, const ConfigType& );
+
+       //takes process and config object as arguments
+       //returns the page the next processing cycle reads
+       //a process stays on its page three cycles out of four and otherwise
+       //  jumps to another one, the same way every run
+       int nextPage( Process&, const ConfigType& );
+
+       //takes process, one of its virtual pages, and config object as
+       //  arguments
+       //looks the page up in the TLB of the CPU running the process, walks
+       //  the page table on a miss and loads the page on a page fault
+       //a page fault with memory full reuses the frame of another loaded
+       //  page of the same process
+       //returns the memory cycles the lookup costs
+       int touchPage( Process&, int, const ConfigType& );
+
+       //takes process as argument
+       //frees every page the process has loaded and drops them from the
+       //  TLBs
+       //clock lock must be held
+       void unloadPages( Process& );
+
+       //takes process and config object as arguments
+       //runs a single process until either complete or quantum limit is
+       //  reached or it waits for I/O
+       //interrupts when quantum limit is reached
+       void runProcess( Process&, const ConfigType& );
+
+       //takes a process that is in EXIT with no I/O running as argument
+       //queues it to be logged as completed
+       //clock lock must be held
+       void processFinished( Process* );
+
+       //logs every process queued by processFinished()
+       //clock lock must be held
+       void logFinished();
+
+       //takes as input a void* casted CoreArg object
+       //cpuPool worker entry point, runs cpuThread() of its simulator
+       static void cpuMain( void* );
+
+       //takes as input CoreArg object
+       //runs one simulated CPU on a cpuPool worker
+       //takes ready processes from its own run queue and runs each for one
+       //  quantum, steals from another CPU when its queue is empty,
+       //  waits while none are ready, returns once every process has exited
+       //puts a process that is still ready back in its own run queue, one
+       //  waiting for I/O is put back by endIo()
+       //a process that migrated here loses the benefit of its earlier
+       //  caching
+       void cpuThread( CoreArg* );
+
+       //takes as input a void* casted CoreArg object
+       //arrivalPool worker entry point, runs arrivalThread() of its
+       //  simulator
+       static void arrivalMain( void* );
+
+       //takes as input CoreArg object
+       //runs on the arrivalPool worker
+       //waits until the arrival time of each process that has one, in
+       //  order, and adds it to the run queue of its CPU
+       void arrivalThread( CoreArg* );
+
+       //takes as input a void* casted ThreadArg object
+       //ioPool worker entry point, runs ioThread() of its simulator
+       static void ioMain( void* );
+
+       //takes as input ThreadArg object
+       //gets input data from ThreadArg object
+       //runs a single I/O operation on an ioPool worker
+       //uses the unit of the device it was given, returns it at end and
+       //  hands it to the next request queued on the device
+       //logs time at beginning, waits for simulated duration, logs time at
+       //  end
+       void ioThread( ThreadArg* );
+
+       //takes the process that owns an I/O request as argument
+       //counts the request as finished, queues the process as finished if
+       //  this was its last request after it exited, and wakes finish() if it
+       //  is waiting for I/O to drain
+       //a process waiting on its last request becomes READY and goes back
+       //  in the run queue of the CPU that last ran it, unless that CPU
+       //  still has it
+       //also takes the device operation and the usec it was busy, counted
+       //  for the report
+       //called before the device is released so the next request on the
+       //  device can't start ahead of the owner's bookkeeping
+       void endIo( Process*, unsigned char, long );
+
+       //takes the process list and config object as arguments
+       //adds the time of every process, CPU and used device to the report
+       void fillReport( RunReport&, const vector<Process>&,
+                        const ConfigType& );
+
+       //simulation clock, wall clock or virtual time
+       SimClock simClock;
+
+       //units of each I/O device by operation, each handed to one request
+       //  at a time, and the requests waiting for one, guarded by the
+       //  clock lock
+       DevicePool devicePools[DEVICE_LIMIT];
+
+       //hard drives and their request queues when disk scheduling is
+       //  simulated, they are taken from here instead of their DevicePool,
+       //  guarded by the clock lock
+       DiskScheduler disks;
+
+       //signaled when an I/O request finishes
+       SimCondition ioFinished;
+
+       //I/O workers, one per device unit, each request given to one holds
+       //  a unit so none of them waits for a device
+       ThreadPool ioPool;
+       int ioCount; //I/O requests submitted and not yet finished
+
+       //log lines are recorded per thread and merged into logSink, naming
+       //  devices from logDevices
+       SimLog simLog;
+       LogDevices logDevices;
+
+       //total processes
+       int ProcessCount;
+
+       //processes not yet in EXIT
+       int liveProcesses;
+
+       //ready processes of each CPU, guarded by the clock lock
+       RunQueues runQueues;
+       SimCondition processReady; //signaled when a process is added or
+                                  //  all exit
+
+       //simulated CPUs, one worker each
+       ThreadPool cpuPool;
+
+       //admits processes with an arrival time, one worker when there are
+       //  any
+       ThreadPool arrivalPool;
+
+       //processes that finished but have not been logged yet
+       SimpleQueue<Process*> finishedProcesses; //guarded by the clock lock
+
+       //monitor and/or log file, flushed in the background
+       //binarySink is the log file when it is binary, logSink then only
+       //  writes to the monitor
+       LogSink logSink, binarySink;
+
+       //simulated physical memory, guarded by the clock lock
+       MemoryManager memory;
+
+       //time of the next MLFQ priority boost in usec, guarded by the clock
+       //  lock
+       long nextBoost;
+
+       //usec each CPU spent running processes, guarded by the clock lock
+       vector<long> cpuBusy;
+
+       //requests and usec busy of each I/O device by operation, guarded by
+       //  the clock lock
+       long deviceRequests[DEVICE_LIMIT];
+       long deviceBusy[DEVICE_LIMIT];
+
+       //TLB of each CPU when paging, guarded by the clock lock
+       vector<Tlb> tlbs;
+       long pageFaults;
+
+       //the workload has an M(allocate) or M(free)
+       bool memoryOps;
+
+       //what was loaded and the threads running it
+       ConfigType config;
+       vector<Process> program;
+       vector<CoreArg> cores;
+       CoreArg arrivals;
+
+       //problems found by loadWorkload(), written once the log is open
+       string loadMessages;
+
+       bool quiet; //nothing is logged or printed
+       bool started; //start() succeeded
+       bool finished; //finish() is done
+
+       //filled in by finish()
+       RunReport report;
+
+       Simulator( const Simulator &copiedSimulator );
+       const Simulator &operator = ( const Simulator &rhSimulator );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_SIMULATOR_H
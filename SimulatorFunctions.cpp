@@ -27,45 +27,6 @@
 
  // None
 
-/**
- * @brief Memory Adress Return Function
- *
- * @details Reads in an integer representing kilobytes of total memory. Using
- *			the total memory, the function returns the address as a hexadecimal
- *			string.
- *          
- * @param in: total memory in kb (int)
- *
- * @pre None
- *
- * @post Hexadecimal string address returned
- *
- * @exception Requires value > 0
- *
- * @exception Address pointer should be null
- */
-unsigned int AllocateMemory( int totMem, int blockSize, int lastLoc )
-{	
-    //memory uninitialized
-	if( lastLoc < 0 )
-	{
-	    return 0;
-	}
-	
-	//check if previous starting address
-	// + space for both previous and new blocks
-	// is less than the total memory, else start at 0
-	else if( lastLoc + blockSize * 2 < totMem )
-	{
-	    return lastLoc + blockSize;
-    }
-    
-    else
-    {
-	    return 0;
-	}
-}
-
 /**
  * @brief Timer Function
  *
@@ -75,12 +36,12 @@ unsigned int AllocateMemory( int totMem, int blockSize, int lastLoc )
  *
  * @pre None
  *
- * @post Returns the microseconds passed as an integer
+ * @post Returns the microseconds passed as a 64-bit integer
  */
-int timePassed( struct timeval refTime )
+long long timePassed( struct timeval refTime )
 {
    struct timeval currentTime;
-   int microsec, seconds;
+   long long microsec, seconds;
 
    gettimeofday( &currentTime, NULL );
    seconds = currentTime.tv_sec - refTime.tv_sec;
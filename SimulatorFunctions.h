@@ -30,7 +30,6 @@
 
  // None
 
-unsigned int AllocateMemory( int totMem, int blockSize, int lastLoc );
-int timePassed( struct timeval refTime );
+long long timePassed( struct timeval refTime );
 
 #endif // MEM_FUNC_H
@@ -0,0 +1,176 @@
+//ThreadPool.cpp
+//implements ThreadPool functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_THREADPOOL_CPP
+#define CLASS_THREADPOOL_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+
+using namespace std;
+
+ThreadPool::ThreadPool
+   (
+    // no parameters
+   )
+       : clock( NULL ), runningWorkers( 0 ), startedWorkers( 0 ),
+         stopping( false )
+{
+    pthread_cond_init( &workerStarted.cond, NULL );
+    workerStarted.blocked = 0;
+    workerStarted.generation = 0;
+    pthread_cond_init( &taskReady.cond, NULL );
+    taskReady.blocked = 0;
+    taskReady.generation = 0;
+    pthread_cond_init( &workerExited.cond, NULL );
+    workerExited.blocked = 0;
+    workerExited.generation = 0;
+}
+
+ThreadPool::~ThreadPool
+   (
+    // no parameters
+   )
+{
+    stop();
+    pthread_cond_destroy( &workerStarted.cond );
+    pthread_cond_destroy( &taskReady.cond );
+    pthread_cond_destroy( &workerExited.cond );
+}
+
+void ThreadPool::start
+   (
+    SimClock *simClock,
+    int workerCount
+   )
+{
+    int index;
+
+    clock = simClock;
+    stopping = false;
+    runningWorkers = workerCount;
+    startedWorkers = 0;
+    workers.resize( workerCount );
+
+    for( index = 0; index < workerCount; index++ )
+    {
+        clock->addThread(); //counted before it starts running
+        pthread_create( &workers[index], NULL, workerMain, (void*)this );
+    }
+
+    //a worker that came up late could take a task ahead of one woken in
+    //  turn, so tasks are only accepted once every worker is idle
+    clock->lock();
+    while( startedWorkers < workerCount )
+    {
+        clock->block( workerStarted );
+    }
+    clock->unlock();
+}
+
+void ThreadPool::submit
+   (
+    void (*function)( void* ),
+    void* arg
+   )
+{
+    PoolTask task;
+
+    task.function = function;
+    task.arg = arg;
+
+    clock->lock();
+    tasks.enqueue( task );
+    clock->notify( taskReady );
+    clock->unlock();
+}
+
+void ThreadPool::stop
+   (
+    // no parameters
+   )
+{
+    unsigned int index;
+
+    if( workers.empty() )
+    {
+        return;
+    }
+
+    //wait through the clock, queued tasks may still need simulated time
+    clock->lock();
+    stopping = true;
+    clock->notify( taskReady );
+    while( runningWorkers > 0 )
+    {
+        clock->block( workerExited );
+    }
+    clock->unlock();
+
+    for( index = 0; index < workers.size(); index++ )
+    {
+        pthread_join( workers[index], NULL );
+    }
+
+    workers.clear();
+}
+
+int ThreadPool::getWorkerCount
+   (
+    // no parameters
+   ) const
+{
+    return workers.size();
+}
+
+void* ThreadPool::workerMain
+   (
+    void* arg
+   )
+{
+    ThreadPool* pool = (ThreadPool*)arg;
+
+    pool->work();
+    pool->clock->removeThread();
+
+    return NULL;
+}
+
+void ThreadPool::work
+   (
+    // no parameters
+   )
+{
+    PoolTask task;
+
+    clock->lock();
+    startedWorkers++;
+    clock->notify( workerStarted );
+    while( true )
+    {
+        while( tasks.isEmpty() && !stopping )
+        {
+            clock->block( taskReady );
+        }
+
+        if( !tasks.dequeue( task ) ) //stopping with nothing left to run
+        {
+            break;
+        }
+
+        clock->unlock();
+        task.function( task.arg );
+        clock->lock();
+    }
+
+    runningWorkers--;
+    clock->notify( workerExited );
+    clock->unlock();
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_THREADPOOL_CPP
@@ -0,0 +1,90 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file ThreadPool.h
+ *
+ * @brief Definition file for ThreadPool class
+ *
+ * @details Specifies a fixed set of worker threads that run submitted tasks
+ *          in order. Workers are simulator threads: they block through the
+ *          SimClock while waiting for work, so an idle pool never holds back
+ *          virtual time.
+ *
+ * @Note start() must be called after the clock has been started
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_THREADPOOL_H
+#define CLASS_THREADPOOL_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <vector>
+#include "SimClock.h"
+#include "SimpleQueue.cpp"
+
+using namespace std;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//one unit of work, function is called with arg on a worker
+struct PoolTask
+{
+    void (*function)( void* );
+    void* arg;
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class ThreadPool
+   {
+    public:
+
+    // constructors
+    ThreadPool();
+
+    // destructor
+    ~ThreadPool();
+
+    // modifiers
+
+       // creates the workers, each registered with the clock
+       // returns once every worker is waiting for a task
+       void start( SimClock *simClock, int workerCount );
+
+       // queues a task for the next free worker
+       void submit( void (*function)( void* ), void* arg );
+
+       // runs every queued task, then joins the workers
+       void stop();
+
+    // accessors
+
+       int getWorkerCount() const;
+
+    private:
+
+       // worker thread entry point, arg is the pool
+       static void* workerMain( void* arg );
+
+       // takes and runs tasks until the pool is stopped
+       void work();
+
+       SimClock *clock;
+       vector<pthread_t> workers;
+       SimpleQueue<PoolTask> tasks; //guarded by the clock lock
+       SimCondition workerStarted;
+       SimCondition taskReady;
+       SimCondition workerExited;
+       int runningWorkers;
+       int startedWorkers; //workers that reached the task loop
+       bool stopping;
+
+       ThreadPool( const ThreadPool &copiedPool );
+       const ThreadPool &operator = ( const ThreadPool &rhPool );
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_THREADPOOL_H
@@ -0,0 +1,158 @@
+//Tlb.cpp
+//implements Tlb functions
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_TLB_CPP
+#define CLASS_TLB_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "Tlb.h"
+
+using namespace std;
+
+Tlb::Tlb
+   (
+    // no parameters
+   )
+       : policy( TLB_LRU ), hand( 0 ), useCount( 0 ), hits( 0 ), misses( 0 )
+{
+	// initializers used
+}
+
+void Tlb::init
+   (
+    int entryCount,
+    int policyId
+   )
+{
+    TlbEntry empty = { 0, 0, 0, false };
+
+    entries.assign( entryCount, empty );
+    policy = policyId;
+    hand = 0;
+    useCount = hits = misses = 0;
+}
+
+bool Tlb::lookup
+   (
+    int processNum,
+    int page
+   )
+{
+    unsigned int index;
+
+    useCount++;
+    for( index = 0; index < entries.size(); index++ )
+    {
+        if( entries[index].processNum == processNum
+                && entries[index].page == page )
+        {
+            entries[index].lastUse = useCount;
+            entries[index].referenced = true;
+            hits++;
+            return true;
+        }
+    }
+
+    misses++;
+    return false;
+}
+
+void Tlb::insert
+   (
+    int processNum,
+    int page
+   )
+{
+    int index;
+
+    if( entries.empty() )
+    {
+        return;
+    }
+
+    index = victim();
+    entries[index].processNum = processNum;
+    entries[index].page = page;
+    entries[index].lastUse = useCount;
+    entries[index].referenced = true;
+}
+
+void Tlb::invalidate
+   (
+    int processNum,
+    int page
+   )
+{
+    unsigned int index;
+
+    for( index = 0; index < entries.size(); index++ )
+    {
+        if( entries[index].processNum == processNum
+                && entries[index].page == page )
+        {
+            entries[index].processNum = 0;
+            entries[index].referenced = false;
+            return;
+        }
+    }
+}
+
+long Tlb::getHits
+   (
+    // no parameters
+   ) const
+{
+    return hits;
+}
+
+long Tlb::getMisses
+   (
+    // no parameters
+   ) const
+{
+    return misses;
+}
+
+int Tlb::victim
+   (
+    // no parameters
+   )
+{
+    unsigned int index, oldest = 0;
+
+    for( index = 0; index < entries.size(); index++ )
+    {
+        if( entries[index].processNum == 0 )
+        {
+            return index;
+        }
+        if( entries[index].lastUse < entries[oldest].lastUse )
+        {
+            oldest = index;
+        }
+    }
+
+    if( policy == TLB_LRU )
+    {
+        return oldest;
+    }
+
+    //give every referenced entry a second chance
+    while( entries[hand].referenced )
+    {
+        entries[hand].referenced = false;
+        hand = ( hand + 1 ) % entries.size();
+    }
+
+    index = hand;
+    hand = ( hand + 1 ) % entries.size();
+
+    return index;
+}
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_TLB_CPP
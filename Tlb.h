@@ -0,0 +1,90 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file Tlb.h
+ *
+ * @brief Definition file for Tlb class
+ *
+ * @details Specifies the translation lookaside buffer of one simulated CPU.
+ *          Entries are tagged with the process number, so nothing is
+ *          flushed when a CPU switches processes. A full TLB replaces the
+ *          least recently used entry, or with CLOCK the first entry the
+ *          hand finds that was not used since the hand last passed it.
+ *          Lookups are counted as hits and misses.
+ *
+ * @Note Not locked, the caller guards it
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef CLASS_TLB_H
+#define CLASS_TLB_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+
+using namespace std;
+
+// Global constants ///////////////////////////////////////////////////////////
+
+//TLB replacement identifiers
+static const int TLB_LRU = 0,
+                 TLB_CLOCK = 1;
+
+// Structure definitions //////////////////////////////////////////////////////
+
+//one translation
+struct TlbEntry
+{
+    int processNum; //0 if the entry is empty
+    int page;
+    long lastUse; //lookup count when last used, LRU
+    bool referenced; //used since the hand passed, CLOCK
+};
+
+// Class definition  //////////////////////////////////////////////////////////
+
+class Tlb
+   {
+    public:
+
+    // constructors
+    Tlb();
+
+    // modifiers
+
+       // empties the TLB and selects the replacement
+       void init( int entryCount, int policyId );
+
+       // looks up a page of a process, counting a hit or a miss
+       // returns true on a hit
+       bool lookup( int processNum, int page );
+
+       // adds the page of a process after a miss
+       void insert( int processNum, int page );
+
+       // drops the page of a process if it is held
+       void invalidate( int processNum, int page );
+
+    // accessors
+
+       long getHits() const;
+
+       long getMisses() const;
+
+    private:
+
+       // entry to replace, an empty one if there is one
+       int victim();
+
+       vector<TlbEntry> entries;
+       int policy;
+       int hand; //CLOCK position
+       long useCount;
+       long hits;
+       long misses;
+   };
+
+// Terminating precompiler directives  ////////////////////////////////////////
+
+#endif		// #ifndef CLASS_TLB_H
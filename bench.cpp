@@ -0,0 +1,597 @@
+//bench.cpp
+//Times the parts of the simulator that set how fast large runs go
+//Input: -r N - timed repetitions of each benchmark, after one untimed
+//              warm up run (default 5)
+//       -f text - only run benchmarks whose name contains the text
+//       -o path - also write the results as JSON
+//Output: One line per benchmark of the operations in a repetition, the
+//            median and best ns per operation, and operations per second
+//            at the median
+//Benchmarks:
+//       parseData, parseCycles - one metadata entry at a time
+//       MetaDataParser - every entry of a metadata file
+//       readInput - a metadata file into processes, Simulator::loadWorkload
+//       SimpleQueue - enqueue and dequeue at a steady size, and growing
+//       Scheduler - take and add back with 10, 1k and 100k ready processes
+//                   for each algorithm
+//       SimLog - records written by 1 to 8 threads at once until merged
+//                and formatted
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include "Simulator.h"
+
+using namespace std;
+
+/* Global Constant Declarations //////////////////////////////////////////////*/
+
+//entries in the metadata file the parser benchmarks read
+static const int FILE_ENTRIES = 200000;
+
+//entry spans each parse benchmark repetition goes through
+static const int SPAN_PASSES = 50;
+
+//records each SimLog writer thread writes
+static const int LOG_RECORDS = 200000;
+
+/* Structure Definitions /////////////////////////////////////////////////////*/
+
+//timings of one benchmark
+struct BenchResult
+{
+    string name;
+    long ops; //operations in each repetition
+    double median; //ns per operation
+    double best;
+    double opsPerSec; //at the median
+};
+
+//one benchmark, body runs one repetition and returns the operations done
+struct BenchCase
+{
+    string name;
+    long (*body)( void* );
+    void* arg;
+};
+
+//holds the metadata file the parser benchmarks read
+struct ParseArg
+{
+    string path;
+    string text; //the whole file
+    vector<string_view> entries; //each entry of text
+};
+
+//holds the scheduler setup of one Scheduler benchmark
+struct SchedulerArg
+{
+    int algorithm;
+    int processes;
+};
+
+//holds the setup of one SimLog benchmark and its writer threads
+struct LogArg
+{
+    int writers;
+    SimLog* log;
+};
+
+/* Function Prototypes ///////////////////////////////////////////////////////*/
+
+//takes a benchmark and the repetitions as arguments
+//runs it once untimed, then times each repetition
+//returns its median and best time per operation
+BenchResult measure( const BenchCase&, int );
+
+//returns a monotonic time in ns
+double nowNs();
+
+//takes the parse setup as argument
+//writes a metadata file of FILE_ENTRIES entries and splits it into spans
+//returns false if the file can't be written
+bool makeWorkload( ParseArg& );
+
+//benchmark bodies, each takes its setup as a void* and returns the
+//  operations it did
+long benchParseData( void* );
+long benchParseCycles( void* );
+long benchParser( void* );
+long benchReadInput( void* );
+long benchQueueSteady( void* );
+long benchQueueGrow( void* );
+long benchScheduler( void* );
+long benchLog( void* );
+
+//takes as input a void* casted LogArg object
+//writes LOG_RECORDS records to its log
+void* logWriter( void* );
+
+//takes the results and repetitions as arguments
+//returns them as one JSON object
+string formatJson( const vector<BenchResult>&, int );
+
+/* Function Implementations //////////////////////////////////////////////////*/
+
+int main( int argc, char* argv[] )
+{
+    vector<BenchCase> cases;
+    vector<BenchResult> results;
+    vector<SchedulerArg> schedulers;
+    vector<LogArg> logs;
+    ParseArg parse;
+    BenchCase benchCase;
+    SchedulerArg scheduler;
+    LogArg log;
+    ostringstream name;
+    string filter, outPath, arg;
+    FILE* out;
+    const char* algorithms[] = { "RR", "SRTF", "SJF", "MLFQ" };
+    int repetitions = 5, index, algorithm, size;
+    const int sizes[] = { 10, 1000, 100000 };
+    const int writers[] = { 1, 2, 4, 8 };
+
+    for( index = 1; index < argc; index++ )
+    {
+        arg = argv[index];
+        if( index + 1 < argc && arg == "-r" )
+        {
+            repetitions = max( 1, atoi( argv[++index] ) );
+        }
+        else if( index + 1 < argc && arg == "-f" )
+        {
+            filter = argv[++index];
+        }
+        else if( index + 1 < argc && arg == "-o" )
+        {
+            outPath = argv[++index];
+        }
+        else
+        {
+            cout << "Usage: bench [-r repetitions] [-f filter]"
+                 << " [-o results.json]" << endl;
+            return 1;
+        }
+    }
+
+    if( !makeWorkload( parse ) )
+    {
+        cout << "Metadata file " << parse.path << " could not be created."
+             << endl;
+        return 1;
+    }
+
+    //every setup is made before the cases point at it
+    for( algorithm = 0; algorithm < 4; algorithm++ )
+    {
+        for( size = 0; size < 3; size++ )
+        {
+            scheduler.algorithm = algorithm;
+            scheduler.processes = sizes[size];
+            schedulers.push_back( scheduler );
+        }
+    }
+    for( index = 0; index < 4; index++ )
+    {
+        log.writers = writers[index];
+        log.log = NULL;
+        logs.push_back( log );
+    }
+
+    benchCase = { "parseData", benchParseData, &parse };
+    cases.push_back( benchCase );
+    benchCase = { "parseCycles", benchParseCycles, &parse };
+    cases.push_back( benchCase );
+    benchCase = { "MetaDataParser", benchParser, &parse };
+    cases.push_back( benchCase );
+    benchCase = { "readInput", benchReadInput, &parse };
+    cases.push_back( benchCase );
+    benchCase = { "SimpleQueue steady", benchQueueSteady, NULL };
+    cases.push_back( benchCase );
+    benchCase = { "SimpleQueue grow", benchQueueGrow, NULL };
+    cases.push_back( benchCase );
+    for( index = 0; index < (int)schedulers.size(); index++ )
+    {
+        name.str( "" );
+        name << "Scheduler " << algorithms[schedulers[index].algorithm]
+             << " " << schedulers[index].processes;
+        benchCase = { name.str(), benchScheduler, &schedulers[index] };
+        cases.push_back( benchCase );
+    }
+    for( index = 0; index < (int)logs.size(); index++ )
+    {
+        name.str( "" );
+        name << "SimLog " << logs[index].writers
+             << ( logs[index].writers == 1 ? " writer" : " writers" );
+        benchCase = { name.str(), benchLog, &logs[index] };
+        cases.push_back( benchCase );
+    }
+
+    printf( "%-24s %10s %14s %14s %14s\n", "Benchmark", "Ops",
+            "Median ns/op", "Best ns/op", "Ops/sec" );
+    for( index = 0; index < (int)cases.size(); index++ )
+    {
+        if( cases[index].name.find( filter ) == string::npos )
+        {
+            continue;
+        }
+
+        results.push_back( measure( cases[index], repetitions ) );
+        printf( "%-24s %10ld %14.2f %14.2f %14.0f\n",
+                results.back().name.c_str(), results.back().ops,
+                results.back().median, results.back().best,
+                results.back().opsPerSec );
+        fflush( stdout );
+    }
+
+    unlink( parse.path.c_str() );
+
+    if( !outPath.empty() )
+    {
+        out = fopen( outPath.c_str(), "w" );
+        if( out == NULL )
+        {
+            cout << "Results file " << outPath << " could not be created."
+                 << endl;
+            return 1;
+        }
+        fputs( formatJson( results, repetitions ).c_str(), out );
+        fclose( out );
+    }
+
+    return 0;
+}
+
+BenchResult measure( const BenchCase& benchCase, int repetitions )
+{
+    BenchResult result;
+    vector<double> times;
+    double start;
+    int repetition;
+
+    benchCase.body( benchCase.arg ); //warm up caches and the allocator
+
+    for( repetition = 0; repetition < repetitions; repetition++ )
+    {
+        start = nowNs();
+        result.ops = benchCase.body( benchCase.arg );
+        times.push_back( ( nowNs() - start ) / max( 1L, result.ops ) );
+    }
+
+    sort( times.begin(), times.end() );
+    result.name = benchCase.name;
+    result.median = ( repetitions % 2 == 1 ) ? times[repetitions / 2]
+                    : ( times[repetitions / 2 - 1] + times[repetitions / 2] )
+                      / 2;
+    result.best = times[0];
+    result.opsPerSec = ( result.median > 0 ) ? 1e9 / result.median : 0;
+
+    return result;
+}
+
+double nowNs()
+{
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+bool makeWorkload( ParseArg& parse )
+{
+    ostringstream text;
+    FILE* file;
+    char path[] = "/tmp/benchXXXXXX";
+    const char* entries[] = { "P(run)11", "M(allocate)2", "I(hard drive)5",
+                              "P(run)7", "O(monitor)3", "M(cache)4",
+                              "P(run)14", "I(keyboard)6", "O(printer)9",
+                              "M(free)1" };
+    size_t start, end;
+    int entry, descriptor, fd;
+
+    //processes of 50 entries, the same file every run
+    text << "Start Program Meta-Data Code:\nS(start)0;";
+    for( entry = 0; entry < FILE_ENTRIES; entry++ )
+    {
+        if( entry % 50 == 0 )
+        {
+            text << ( entry > 0 ? " A(end)0;" : "" ) << "\nA(start)0;";
+        }
+        descriptor = ( entry * 7 ) % 10;
+        text << ' ' << entries[descriptor] << ';';
+    }
+    text << " A(end)0;\nS(end)0.\nEnd Program Meta-Data Code.\n";
+    parse.text = text.str();
+
+    fd = mkstemp( path );
+    parse.path = path;
+    file = ( fd < 0 ) ? NULL : fdopen( fd, "w" );
+    if( file == NULL )
+    {
+        return false;
+    }
+    fwrite( parse.text.data(), 1, parse.text.size(), file );
+    fclose( file );
+
+    //spans of every entry, the way the parser hands them on
+    start = parse.text.find( ':' ) + 1;
+    while( ( end = parse.text.find_first_of( ";.", start ) )
+           != string::npos )
+    {
+        start = parse.text.find_first_not_of( " \n", start );
+        parse.entries.push_back( string_view( parse.text.data() + start,
+                                              end - start ) );
+        start = end + 1;
+        if( parse.text[end] == '.' )
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+long benchParseData( void* arg )
+{
+    const vector<string_view>& entries = ((ParseArg*)arg)->entries;
+    unsigned int index;
+    int pass;
+    size_t total = 0;
+
+    for( pass = 0; pass < SPAN_PASSES; pass++ )
+    {
+        for( index = 0; index < entries.size(); index++ )
+        {
+            total += parseData( entries[index] ).size();
+        }
+    }
+
+    //keeps the compiler from dropping the calls
+    if( total == 0 )
+    {
+        cout << "parseData found nothing" << endl;
+    }
+
+    return (long)SPAN_PASSES * entries.size();
+}
+
+long benchParseCycles( void* arg )
+{
+    const vector<string_view>& entries = ((ParseArg*)arg)->entries;
+    unsigned int index;
+    int pass, cycles;
+    long total = 0;
+
+    for( pass = 0; pass < SPAN_PASSES; pass++ )
+    {
+        for( index = 0; index < entries.size(); index++ )
+        {
+            if( parseCycles( entries[index], cycles ) )
+            {
+                total += cycles;
+            }
+        }
+    }
+
+    if( total == 0 )
+    {
+        cout << "parseCycles found nothing" << endl;
+    }
+
+    return (long)SPAN_PASSES * entries.size();
+}
+
+long benchParser( void* arg )
+{
+    MetaDataParser parser;
+    DeviceRegistry devices;
+    MetaDataType entry;
+    DeviceType hardDrive = { "hard drive", "HDD", 1, 0, true, true },
+               keyboard = { "keyboard", "", 1, 0, true, false },
+               monitor = { "monitor", "", 1, 0, false, true },
+               printer = { "printer", "PRNTR", 1, 0, false, true };
+    long count = 0;
+
+    devices.set( OP_HARD_DRIVE, hardDrive );
+    devices.set( OP_KEYBOARD, keyboard );
+    devices.set( OP_MONITOR, monitor );
+    devices.set( OP_PRINTER, printer );
+
+    if( parser.open( ((ParseArg*)arg)->path, devices ) )
+    {
+        while( parser.next( entry ) != PARSE_END )
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+long benchReadInput( void* arg )
+{
+    Simulator* simulator = new Simulator;
+    istringstream config(
+        "Start Simulator Configuration File\n"
+        "File Path: " + ((ParseArg*)arg)->path + "\n"
+        "Processor Quantum Number: 4\nCPU Scheduling Code: RR\n"
+        "Processor cycle time (msec): 5\nMonitor display time (msec): 22\n"
+        "Hard drive cycle time (msec): 150\n"
+        "Printer cycle time (msec): 550\nKeyboard cycle time (msec): 60\n"
+        "Memory cycle time (msec): 10\nSystem memory (kbytes): 2048\n"
+        "Memory block size (kbytes): 128\nPrinter quantity: 4\n"
+        "Hard drive quantity: 2\nLog: Log to Monitor\n"
+        "Log File Path: none.lgf\nEnd Simulator Configuration File\n" );
+
+    simulator->loadConfig( config );
+    simulator->loadWorkload();
+    delete simulator;
+
+    return ((ParseArg*)arg)->entries.size();
+}
+
+long benchQueueSteady( void* )
+{
+    SimpleQueue<int> queue;
+    int index, value;
+    long long total = 0; //an int sum would overflow
+    const int steady = 1000, pairs = 20000000;
+
+    for( index = 0; index < steady; index++ )
+    {
+        queue.enqueue( index );
+    }
+
+    for( index = 0; index < pairs; index++ )
+    {
+        queue.dequeue( value );
+        total += value;
+        queue.enqueue( value );
+    }
+
+    if( total == 0 )
+    {
+        cout << "SimpleQueue found nothing" << endl;
+    }
+
+    return pairs;
+}
+
+long benchQueueGrow( void* )
+{
+    SimpleQueue<int> queue;
+    int index, value;
+    long long total = 0; //an int sum would overflow
+    const int items = 4000000;
+
+    for( index = 0; index < items; index++ )
+    {
+        queue.enqueue( index );
+    }
+    while( queue.dequeue( value ) )
+    {
+        total += value;
+    }
+
+    if( total == 0 )
+    {
+        cout << "SimpleQueue found nothing" << endl;
+    }
+
+    return 2L * items;
+}
+
+long benchScheduler( void* arg )
+{
+    const SchedulerArg& setup = *(SchedulerArg*)arg;
+    Scheduler scheduler;
+    vector<int> timeLeft( setup.processes ), jobLength( setup.processes );
+    vector<int> level( setup.processes, 0 );
+    int index, process, rounds = 2000000;
+
+    scheduler.init( setup.algorithm, 3 );
+    for( index = 0; index < setup.processes; index++ )
+    {
+        timeLeft[index] = jobLength[index] = 1000 + ( index * 7919 ) % 100000;
+        scheduler.add( index, timeLeft[index], 0 );
+    }
+
+    //each round runs the next process a little and puts it back, SJF
+    //  keeps ordering by the length of the job
+    for( index = 0; index < rounds; index++ )
+    {
+        process = scheduler.take();
+        timeLeft[process] = max( 1, timeLeft[process] - 3 );
+        level[process] = min( level[process] + 1, 2 );
+        scheduler.add( process, setup.algorithm == SJF ? jobLength[process]
+                                                       : timeLeft[process],
+                       level[process] );
+        if( setup.algorithm == MLFQ && index % 10000 == 0 )
+        {
+            scheduler.boost();
+            fill( level.begin(), level.end(), 0 );
+        }
+    }
+
+    return rounds;
+}
+
+long benchLog( void* arg )
+{
+    LogArg& setup = *(LogArg*)arg;
+    SimClock clock;
+    LogDevices devices;
+    LogSink sink;
+    SimLog* log = new SimLog;
+    vector<pthread_t> threads( setup.writers );
+    int index;
+
+    //formatted and written like a real log, to nowhere
+    clock.start( false );
+    sink.open( false, "/dev/null" );
+    log->start( &clock, &devices, &sink );
+    setup.log = log;
+
+    for( index = 0; index < setup.writers; index++ )
+    {
+        pthread_create( &threads[index], NULL, logWriter, arg );
+    }
+    for( index = 0; index < setup.writers; index++ )
+    {
+        pthread_join( threads[index], NULL );
+    }
+
+    log->stop(); //every record is merged and formatted after this
+    sink.close();
+    delete log;
+
+    return (long)setup.writers * LOG_RECORDS;
+}
+
+void* logWriter( void* arg )
+{
+    SimLog* log = ((LogArg*)arg)->log;
+    int record;
+
+    for( record = 0; record < LOG_RECORDS; record++ )
+    {
+        log->write( LOG_RUN_START, record & 1023 );
+    }
+
+    return NULL;
+}
+
+string formatJson( const vector<BenchResult>& results, int repetitions )
+{
+    string json;
+    char line[512];
+    unsigned int index;
+
+    snprintf( line, sizeof( line ), "{\n  \"repetitions\": %d,\n"
+              "  \"benchmarks\": [", repetitions );
+    json = line;
+
+    for( index = 0; index < results.size(); index++ )
+    {
+        snprintf( line, sizeof( line ),
+                  "%s\n    { \"name\": \"%s\", \"ops\": %ld, "
+                  "\"median_ns_per_op\": %.3f, \"best_ns_per_op\": %.3f, "
+                  "\"ops_per_sec\": %.0f }", index > 0 ? "," : "",
+                  results[index].name.c_str(), results[index].ops,
+                  results[index].median, results[index].best,
+                  results[index].opsPerSec );
+        json += line;
+    }
+    json += "\n  ]\n}\n";
+
+    return json;
+}
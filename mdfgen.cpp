@@ -0,0 +1,538 @@
+//mdfgen.cpp
+//Writes a synthetic metadata file for benchmarking the simulator
+//Input: -p N - processes (default 10)
+//       -n N - operations of an average process, each has between half and
+//              one and a half times as many (default 20)
+//       -m P,M,I,O - relative weights of processing, memory, input and
+//                    output operations (default 60,20,10,10)
+//       -c K=LOW-HIGH or K=~MEAN - cycles of operations of kind K (P, M, I
+//                                  or O), uniform between LOW and HIGH or
+//                                  exponential around MEAN, at least 1
+//                                  (default P=1-15, M=1-5, I=1-10, O=1-10)
+//       -i name:weight,... - input devices and how often each is used
+//                            (default hard drive:1,keyboard:1)
+//       -o name:weight,... - output devices and how often each is used
+//                            (default hard drive:1,monitor:1,printer:1)
+//       -t N - give each hard drive entry a track below N (default 0, none)
+//       -a N - each process after the first arrives up to N msec into the
+//              simulation (default 0, all start in a run queue)
+//       -s N - random seed, the same seed writes the same file (default 1)
+//       file - written instead of the monitor
+//Output: Metadata file with the same syntax as the hand written ones,
+//            written as it is generated so it can be any size
+//Devices other than the built in ones need a Device line in the config
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+using namespace std;
+
+/* Global Constant Declarations //////////////////////////////////////////////*/
+
+//operation kinds, the order of the -m weights
+static const int KIND_RUN = 0,
+                 KIND_MEMORY = 1,
+                 KIND_INPUT = 2,
+                 KIND_OUTPUT = 3,
+                 KIND_COUNT = 4;
+
+//bytes written to the file at once
+static const size_t OUTPUT_BUFFER_SIZE = 1 << 20;
+
+//entries on one line of the file
+static const int ENTRIES_PER_LINE = 8;
+
+/* Structure Definitions /////////////////////////////////////////////////////*/
+
+//cycles of one kind of operation, uniform between low and high, or
+//  exponential around mean when it is above 0
+struct CycleRange
+{
+    int low;
+    int high;
+    double mean;
+};
+
+//a device and how often it is picked against the others
+struct DeviceWeight
+{
+    string name;
+    int weight;
+};
+
+//holds the command line settings
+struct GenOptions
+{
+    int processes;
+    int operations; //of an average process
+    unsigned long seed;
+    int weight[KIND_COUNT]; //relative weight of each operation kind
+    CycleRange cycles[KIND_COUNT];
+    vector<DeviceWeight> inputs;
+    vector<DeviceWeight> outputs;
+    int tracks; //0 when hard drive entries name no track
+    int arrivalSpread; //msec, 0 when every process starts ready
+    string path; //empty for the monitor
+};
+
+//output collected into large writes
+struct OutBuffer
+{
+    FILE* file;
+    char* data;
+    size_t used;
+    int lineEntries; //entries on the current line
+};
+
+/* Function Prototypes ///////////////////////////////////////////////////////*/
+
+//takes the command line and options object as arguments
+//sets every option given and the defaults of the rest
+//returns false and reports it if an argument is not understood
+bool readOptions( int, char*[], GenOptions& );
+
+//takes a "P,M,I,O" argument and the weights to set as arguments
+//returns false if there are not four whole numbers with a positive sum
+bool readMix( const string&, int[] );
+
+//takes a "K=LOW-HIGH" or "K=~MEAN" argument and options object as
+//  arguments
+//sets the cycle range of that kind
+//returns false if it is not understood
+bool readCycles( const string&, GenOptions& );
+
+//takes a "name:weight,..." argument and device list as arguments
+//replaces the list, a name without a weight counts once
+//returns false if no device is named
+bool readDevices( const string&, vector<DeviceWeight>& );
+
+//takes the random state as argument
+//advances it and returns the next 64 random bits, xorshift64*
+unsigned long nextRandom( unsigned long& );
+
+//takes a bound and the random state as arguments
+//returns a number from 0 up to but not including the bound
+unsigned long randomBelow( unsigned long, unsigned long& );
+
+//takes a cycle range and the random state as arguments
+//returns the cycles of one operation
+int drawCycles( const CycleRange&, unsigned long& );
+
+//takes a device list and the random state as arguments
+//returns the name of a device, picked by weight
+const string& pickDevice( const vector<DeviceWeight>&, unsigned long& );
+
+//takes the output buffer and text as arguments
+//adds the text, writing the buffer out when it is full
+void writeText( OutBuffer&, const char*, size_t );
+
+//takes the output buffer, code, descriptor, cycles, the number after
+//  '@', -1 when there is none, and the character ending the entry as
+//  arguments
+//adds one entry, starting a new line after every few
+void writeEntry( OutBuffer&, char, const string&, int, int, char = ';' );
+
+//takes the output buffer as argument
+//writes out everything it holds
+void flushOutput( OutBuffer& );
+
+/* Function Implementations //////////////////////////////////////////////////*/
+
+int main( int argc, char* argv[] )
+{
+    GenOptions options;
+    OutBuffer out;
+    unsigned long state;
+    int process, operation, count, kind, allocated, total, pick, memoryOp;
+    const char* header = "Start Program Meta-Data Code:\n";
+    const char* footer = "End Program Meta-Data Code.\n";
+
+    if( !readOptions( argc, argv, options ) )
+    {
+        return 1;
+    }
+
+    out.file = options.path.empty() ? stdout
+                                    : fopen( options.path.c_str(), "w" );
+    if( out.file == NULL )
+    {
+        cout << "Metadata file " << options.path << " could not be created."
+             << endl;
+        return 1;
+    }
+    out.data = new char[OUTPUT_BUFFER_SIZE];
+    out.used = 0;
+    out.lineEntries = 0;
+
+    //xorshift gets stuck on a state of 0
+    state = options.seed * 0x9E3779B97F4A7C15UL + 1;
+
+    total = 0;
+    for( kind = 0; kind < KIND_COUNT; kind++ )
+    {
+        total += options.weight[kind];
+    }
+
+    writeText( out, header, strlen( header ) );
+    writeEntry( out, 'S', "start", 0, -1 );
+
+    for( process = 0; process < options.processes; process++ )
+    {
+        writeEntry( out, 'A', "start", 0, ( process > 0
+                    && options.arrivalSpread > 0 )
+                    ? (int)randomBelow( options.arrivalSpread + 1, state )
+                    : -1 );
+
+        count = options.operations / 2 + (int)randomBelow(
+                    options.operations + 1, state );
+        count = max( 1, count );
+        allocated = 0;
+
+        for( operation = 0; operation < count; operation++ )
+        {
+            //the kind whose weights cover the pick
+            pick = (int)randomBelow( total, state );
+            for( kind = 0; pick >= options.weight[kind]; kind++ )
+            {
+                pick -= options.weight[kind];
+            }
+
+            if( kind == KIND_RUN )
+            {
+                writeEntry( out, 'P', "run",
+                            drawCycles( options.cycles[kind], state ), -1 );
+            }
+            else if( kind == KIND_MEMORY )
+            {
+                //only free what the process has allocated
+                memoryOp = (int)randomBelow( allocated > 0 ? 3 : 2, state );
+                if( memoryOp == 0 )
+                {
+                    allocated++;
+                }
+                else if( memoryOp == 2 )
+                {
+                    allocated--;
+                }
+                writeEntry( out, 'M', memoryOp == 0 ? "allocate"
+                                      : memoryOp == 1 ? "cache" : "free",
+                            drawCycles( options.cycles[kind], state ), -1 );
+            }
+            else
+            {
+                const string& device = pickDevice( kind == KIND_INPUT
+                                                   ? options.inputs
+                                                   : options.outputs, state );
+
+                writeEntry( out, kind == KIND_INPUT ? 'I' : 'O', device,
+                            drawCycles( options.cycles[kind], state ),
+                            ( options.tracks > 0 && device == "hard drive" )
+                            ? (int)randomBelow( options.tracks, state ) : -1 );
+            }
+        }
+
+        writeEntry( out, 'A', "end", 0, -1 );
+    }
+
+    //the last entry ends with a period
+    writeEntry( out, 'S', "end", 0, -1, '.' );
+    writeText( out, "\n", 1 );
+    writeText( out, footer, strlen( footer ) );
+    flushOutput( out );
+
+    delete [] out.data;
+    if( out.file != stdout && fclose( out.file ) != 0 )
+    {
+        cout << "Metadata file " << options.path << " could not be written."
+             << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+bool readOptions( int argc, char* argv[], GenOptions& options )
+{
+    string arg, value;
+    int index;
+    bool known;
+
+    options.processes = 10;
+    options.operations = 20;
+    options.seed = 1;
+    readMix( "60,20,10,10", options.weight );
+    readCycles( "P=1-15", options );
+    readCycles( "M=1-5", options );
+    readCycles( "I=1-10", options );
+    readCycles( "O=1-10", options );
+    readDevices( "hard drive:1,keyboard:1", options.inputs );
+    readDevices( "hard drive:1,monitor:1,printer:1", options.outputs );
+    options.tracks = 0;
+    options.arrivalSpread = 0;
+
+    for( index = 1; index < argc; index++ )
+    {
+        arg = argv[index];
+        if( arg.size() != 2 || arg[0] != '-' )
+        {
+            options.path = arg;
+            continue;
+        }
+
+        if( index + 1 >= argc )
+        {
+            cout << "Missing value after " << arg << endl;
+            return false;
+        }
+        value = argv[++index];
+
+        switch( arg[1] )
+        {
+        case 'p':
+            options.processes = max( 0, atoi( value.c_str() ) );
+            known = true;
+            break;
+
+        case 'n':
+            options.operations = max( 1, atoi( value.c_str() ) );
+            known = true;
+            break;
+
+        case 's':
+            options.seed = strtoul( value.c_str(), NULL, 10 );
+            known = true;
+            break;
+
+        case 'm':
+            known = readMix( value, options.weight );
+            break;
+
+        case 'c':
+            known = readCycles( value, options );
+            break;
+
+        case 'i':
+            known = readDevices( value, options.inputs );
+            break;
+
+        case 'o':
+            known = readDevices( value, options.outputs );
+            break;
+
+        case 't':
+            options.tracks = max( 0, atoi( value.c_str() ) );
+            known = true;
+            break;
+
+        case 'a':
+            options.arrivalSpread = max( 0, atoi( value.c_str() ) );
+            known = true;
+            break;
+
+        default:
+            known = false;
+        }
+
+        if( !known )
+        {
+            cout << "Usage: mdfgen [-p processes] [-n operations] [-m P,M,I,O]"
+                 << " [-c K=LOW-HIGH|K=~MEAN]... [-i name:weight,...]"
+                 << " [-o name:weight,...] [-t tracks] [-a msec] [-s seed]"
+                 << " [file]" << endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool readMix( const string& value, int weight[] )
+{
+    istringstream fields( value );
+    string text;
+    int kind = 0, total = 0, parsed[KIND_COUNT];
+
+    while( getline( fields, text, ',' ) && kind < KIND_COUNT )
+    {
+        parsed[kind] = max( 0, atoi( text.c_str() ) );
+        total += parsed[kind];
+        kind++;
+    }
+
+    if( kind < KIND_COUNT || total <= 0 )
+    {
+        return false;
+    }
+
+    for( kind = 0; kind < KIND_COUNT; kind++ )
+    {
+        weight[kind] = parsed[kind];
+    }
+
+    return true;
+}
+
+bool readCycles( const string& value, GenOptions& options )
+{
+    const char* kinds = "PMIO";
+    const char* found;
+    CycleRange range;
+    size_t dash;
+
+    if( value.size() < 3 || value[1] != '='
+            || ( found = strchr( kinds, value[0] ) ) == NULL )
+    {
+        return false;
+    }
+
+    if( value[2] == '~' ) //exponential
+    {
+        range.mean = atof( value.c_str() + 3 );
+        range.low = range.high = 1;
+        if( range.mean <= 0 )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        dash = value.find( '-', 2 );
+        range.mean = 0;
+        range.low = max( 1, atoi( value.c_str() + 2 ) );
+        range.high = ( dash == string::npos ) ? range.low
+                     : max( range.low, atoi( value.c_str() + dash + 1 ) );
+    }
+
+    options.cycles[found - kinds] = range;
+
+    return true;
+}
+
+bool readDevices( const string& value, vector<DeviceWeight>& devices )
+{
+    istringstream fields( value );
+    string text;
+    DeviceWeight device;
+    size_t colon;
+
+    devices.clear();
+    while( getline( fields, text, ',' ) )
+    {
+        colon = text.find( ':' );
+        device.name = text.substr( 0, colon );
+        device.name.erase( 0, device.name.find_first_not_of( " \t" ) );
+        device.name.erase( device.name.find_last_not_of( " \t" ) + 1 );
+        device.weight = ( colon == string::npos ) ? 1
+                        : max( 0, atoi( text.c_str() + colon + 1 ) );
+
+        if( !device.name.empty() && device.weight > 0 )
+        {
+            devices.push_back( device );
+        }
+    }
+
+    return !devices.empty();
+}
+
+unsigned long nextRandom( unsigned long& state )
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    return state * 0x2545F4914F6CDD1DUL;
+}
+
+unsigned long randomBelow( unsigned long bound, unsigned long& state )
+{
+    return ( nextRandom( state ) >> 11 ) % bound;
+}
+
+int drawCycles( const CycleRange& range, unsigned long& state )
+{
+    double uniform;
+
+    if( range.mean > 0 )
+    {
+        //53 random bits as a fraction above 0
+        uniform = ( ( nextRandom( state ) >> 11 ) + 1.0 ) / 9007199254740993.0;
+        return max( 1, (int)( -range.mean * log( uniform ) + 0.5 ) );
+    }
+
+    return range.low + (int)randomBelow( range.high - range.low + 1, state );
+}
+
+const string& pickDevice( const vector<DeviceWeight>& devices,
+                          unsigned long& state )
+{
+    unsigned int index;
+    int total = 0, pick;
+
+    for( index = 0; index < devices.size(); index++ )
+    {
+        total += devices[index].weight;
+    }
+
+    pick = (int)randomBelow( total, state );
+    for( index = 0; pick >= devices[index].weight; index++ )
+    {
+        pick -= devices[index].weight;
+    }
+
+    return devices[index].name;
+}
+
+void writeText( OutBuffer& out, const char* text, size_t length )
+{
+    if( out.used + length > OUTPUT_BUFFER_SIZE )
+    {
+        flushOutput( out );
+    }
+
+    memcpy( out.data + out.used, text, length );
+    out.used += length;
+}
+
+void writeEntry( OutBuffer& out, char code, const string& descriptor,
+                 int cycles, int at, char end )
+{
+    char entry[320];
+    int length;
+
+    //entries on a line are space separated
+    if( out.lineEntries == ENTRIES_PER_LINE )
+    {
+        writeText( out, "\n", 1 );
+        out.lineEntries = 0;
+    }
+    else if( out.lineEntries > 0 )
+    {
+        writeText( out, " ", 1 );
+    }
+
+    if( at >= 0 )
+    {
+        length = snprintf( entry, sizeof( entry ), "%c(%s)%d@%d%c", code,
+                           descriptor.c_str(), cycles, at, end );
+    }
+    else
+    {
+        length = snprintf( entry, sizeof( entry ), "%c(%s)%d%c", code,
+                           descriptor.c_str(), cycles, end );
+    }
+
+    writeText( out, entry, min( length, (int)sizeof( entry ) - 1 ) );
+    out.lineEntries++;
+}
+
+void flushOutput( OutBuffer& out )
+{
+    fwrite( out.data, 1, out.used, out.file );
+    out.used = 0;
+}
@@ -0,0 +1,469 @@
+//simbatch.cpp
+//Runs the simulator over a matrix of configs, workloads and settings
+//Input: Configuration files, run as given or with settings swept
+//       Metadata files (.mdf), each run in place of the one a config names
+//       -s "key: value|value|..." - runs every config with each value of
+//                                   the config line with that key, added
+//                                   before the end marker if it is missing,
+//                                   repeat to sweep more keys together
+//       -j N - simulations run at the same time (default one per core)
+//       -o path - also write the table to a file, as CSV when it ends in
+//                 .csv and as JSON otherwise
+//Output: One line per run of its config, workload, settings and
+//            performance summary, in the order the runs were listed
+//        Runs whose config or metadata can't be read are listed as failed
+//            and the batch exits with 1
+//Runs are quiet, nothing they would log is written
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Simulator.h"
+
+using namespace std;
+
+/* Structure Definitions /////////////////////////////////////////////////////*/
+
+//one config key and the values it is swept over
+struct Sweep
+{
+    string key;
+    vector<string> values;
+};
+
+//one simulation of the batch
+struct BatchJob
+{
+    int config; //index in the config list
+    string workload; //metadata file, empty for the one the config names
+    vector<string> settings; //"key: value" lines changed in the config
+    bool failed; //config or metadata couldn't be read, nothing was run
+    RunReport report;
+};
+
+//shared by the batch workers
+struct BatchArg
+{
+    const vector<string>* configText;
+    vector<BatchJob>* jobs;
+    atomic<unsigned int> nextJob;
+};
+
+/* Function Prototypes ///////////////////////////////////////////////////////*/
+
+//takes the text of a config file and one "key: value" line as arguments
+//replaces the line of the config with the same key, or adds it before
+//  the end marker
+void applySetting( string&, const string& );
+
+//takes a "key: value|value|..." argument and sweep object as arguments
+//splits it into the key and its values
+//returns false if there is no key or no value
+bool readSweep( const string&, Sweep& );
+
+//takes as input a void* casted BatchArg object
+//runs jobs on one worker thread until every job is taken
+void* batchWorker( void* );
+
+//takes the config names and jobs as arguments
+//returns the text table written to the monitor, or a CSV or JSON file
+string formatTable( const vector<string>&, const vector<BatchJob>& );
+string formatCsv( const vector<string>&, const vector<BatchJob>& );
+string formatJson( const vector<string>&, const vector<BatchJob>& );
+
+/* Function Implementations //////////////////////////////////////////////////*/
+
+int main( int argc, char* argv[] )
+{
+    vector<string> configs, configText, workloads;
+    vector<Sweep> sweeps;
+    vector<BatchJob> jobs;
+    vector<pthread_t> workers;
+    BatchJob job;
+    BatchArg batch;
+    Sweep sweep;
+    ifstream fin;
+    ofstream fout;
+    ostringstream text;
+    string arg, outPath;
+    unsigned int index, combo, combos = 1, place, workerCount = 0;
+    int argIndex, config, workload, status = 0;
+    long cores = sysconf( _SC_NPROCESSORS_ONLN );
+
+    for( argIndex = 1; argIndex < argc; argIndex++ )
+    {
+        arg = argv[argIndex];
+        if( ( arg == "-j" || arg == "-o" || arg == "-s" )
+                && argIndex + 1 < argc )
+        {
+            argIndex++;
+            if( arg == "-j" )
+            {
+                workerCount = max( 1, atoi( argv[argIndex] ) );
+            }
+            else if( arg == "-o" )
+            {
+                outPath = argv[argIndex];
+            }
+            else if( !readSweep( argv[argIndex], sweep ) )
+            {
+                cout << "Bad setting sweep: " << argv[argIndex] << endl;
+                return 1;
+            }
+            else
+            {
+                sweeps.push_back( sweep );
+                combos *= sweep.values.size();
+            }
+        }
+        else if( arg.size() > 4
+                 && arg.compare( arg.size() - 4, 4, ".mdf" ) == 0 )
+        {
+            workloads.push_back( arg );
+        }
+        else
+        {
+            configs.push_back( arg );
+        }
+    }
+
+    if( configs.empty() )
+    {
+        cout << "Usage: simbatch [-j jobs] [-o report.csv|report.json]"
+             << " [-s \"key: value|value\"]... config... [workload.mdf]..."
+             << endl;
+        return 1;
+    }
+
+    //every config is read once, each job changes its own copy
+    for( index = 0; index < configs.size(); index++ )
+    {
+        fin.open( configs[index].c_str() );
+        if( !fin )
+        {
+            cout << "No configuration file found: " << configs[index] << endl;
+            return 1;
+        }
+        text.str( "" );
+        text << fin.rdbuf();
+        configText.push_back( text.str() );
+        fin.close();
+    }
+
+    //configs, then workloads, then sweep values, the last key fastest
+    for( config = 0; config < (int)configs.size(); config++ )
+    {
+        for( workload = workloads.empty() ? -1 : 0;
+             workload < (int)workloads.size(); workload++ )
+        {
+            for( combo = 0; combo < combos; combo++ )
+            {
+                job.config = config;
+                job.workload = ( workload < 0 ) ? "" : workloads[workload];
+                job.settings.clear();
+                job.failed = false;
+
+                place = combo;
+                for( index = sweeps.size(); index-- > 0; )
+                {
+                    job.settings.insert( job.settings.begin(),
+                            sweeps[index].key + ": " + sweeps[index].values[
+                                    place % sweeps[index].values.size()] );
+                    place /= sweeps[index].values.size();
+                }
+
+                jobs.push_back( job );
+            }
+        }
+    }
+
+    if( workerCount == 0 )
+    {
+        workerCount = ( cores > 0 ) ? cores : 1;
+    }
+    workerCount = min( workerCount, (unsigned int)jobs.size() );
+
+    batch.configText = &configText;
+    batch.jobs = &jobs;
+    batch.nextJob = 0;
+    workers.resize( workerCount );
+    for( index = 0; index < workerCount; index++ )
+    {
+        pthread_create( &workers[index], NULL, batchWorker, (void*)&batch );
+    }
+    for( index = 0; index < workerCount; index++ )
+    {
+        pthread_join( workers[index], NULL );
+    }
+    for( index = 0; index < jobs.size(); index++ )
+    {
+        if( jobs[index].failed )
+        {
+            status = 1;
+        }
+    }
+
+    cout << formatTable( configs, jobs );
+
+    if( !outPath.empty() )
+    {
+        fout.open( outPath.c_str() );
+        if( outPath.size() > 4
+                && outPath.compare( outPath.size() - 4, 4, ".csv" ) == 0 )
+        {
+            fout << formatCsv( configs, jobs );
+        }
+        else
+        {
+            fout << formatJson( configs, jobs );
+        }
+
+        if( !fout.good() )
+        {
+            cout << "Report file " << outPath << " could not be created."
+                 << endl;
+            return 1;
+        }
+        fout.close();
+    }
+
+    return status;
+}
+
+void applySetting( string& text, const string& setting )
+{
+    string key = setting.substr( 0, setting.find( ':' ) ), lineKey;
+    size_t start = 0, end, colon;
+
+    while( start < text.size() )
+    {
+        end = text.find( '\n', start );
+        if( end == string::npos )
+        {
+            end = text.size();
+        }
+
+        colon = text.find( ':', start );
+        lineKey = ( colon < end ) ? text.substr( start, colon - start ) : "";
+        if( lineKey == key )
+        {
+            text.replace( start, end - start, setting );
+            return;
+        }
+
+        if( text.compare( start, 3, "End" ) == 0 )
+        {
+            break;
+        }
+        start = end + 1;
+    }
+
+    text.insert( min( start, text.size() ), setting + "\n" );
+}
+
+bool readSweep( const string& arg, Sweep& sweep )
+{
+    istringstream values;
+    string value;
+    size_t colon = arg.find( ':' );
+
+    if( colon == string::npos || colon == 0 )
+    {
+        return false;
+    }
+
+    sweep.key = arg.substr( 0, colon );
+    sweep.key.erase( 0, sweep.key.find_first_not_of( " \t" ) );
+    sweep.key.erase( sweep.key.find_last_not_of( " \t" ) + 1 );
+    sweep.values.clear();
+    values.str( arg.substr( colon + 1 ) );
+    while( getline( values, value, '|' ) )
+    {
+        value.erase( 0, value.find_first_not_of( " \t" ) ); //trim spaces
+        value.erase( value.find_last_not_of( " \t" ) + 1 );
+        if( !value.empty() )
+        {
+            sweep.values.push_back( value );
+        }
+    }
+
+    return !sweep.values.empty();
+}
+
+void* batchWorker( void* arg )
+{
+    BatchArg& batch = *(BatchArg*)arg;
+    Simulator* simulator;
+    istringstream configText;
+    string text;
+    unsigned int next, index;
+
+    while( ( next = batch.nextJob++ ) < batch.jobs->size() )
+    {
+        BatchJob& job = (*batch.jobs)[next];
+
+        text = (*batch.configText)[job.config];
+        if( !job.workload.empty() )
+        {
+            applySetting( text, "File Path: " + job.workload );
+        }
+        for( index = 0; index < job.settings.size(); index++ )
+        {
+            applySetting( text, job.settings[index] );
+        }
+
+        configText.clear();
+        configText.str( text );
+
+        //each run has its own clock, CPUs, devices and log
+        simulator = new Simulator;
+        job.failed = ( simulator->run( configText, true ) != 0 );
+        job.report = simulator->getReport();
+        delete simulator;
+    }
+
+    return NULL;
+}
+
+string formatTable( const vector<string>& configs,
+                    const vector<BatchJob>& jobs )
+{
+    string table, settings;
+    char line[1024], one[24], two[24], three[24], four[24];
+    unsigned int index, setting;
+    double response, turnaround, waiting;
+
+    table = "Config               Workload        Elapsed       Done  "
+            "Response      Turnaround    Waiting       CPU     Settings\n";
+    for( index = 0; index < jobs.size(); index++ )
+    {
+        const BatchJob& job = jobs[index];
+
+        settings = "";
+        for( setting = 0; setting < job.settings.size(); setting++ )
+        {
+            settings += ( setting > 0 ? ", " : "" ) + job.settings[setting];
+        }
+
+        if( job.failed )
+        {
+            snprintf( line, sizeof( line ), "%-20s %-15s %-69s ",
+                      configs[job.config].c_str(),
+                      job.workload.empty() ? "-" : job.workload.c_str(),
+                      "failed" );
+            table += line + settings + "\n";
+            continue;
+        }
+
+        job.report.averages( response, turnaround, waiting );
+        snprintf( line, sizeof( line ),
+                  "%-20s %-15s %-13s %-5d %-13s %-13s %-13s %6.2f%% ",
+                  configs[job.config].c_str(),
+                  job.workload.empty() ? "-" : job.workload.c_str(),
+                  seconds( job.report.getElapsed(), one ),
+                  job.report.getCompleted(), averageSeconds( response, two ),
+                  averageSeconds( turnaround, three ),
+                  averageSeconds( waiting, four ),
+                  100.0 * job.report.getCpuUtilization() );
+        table += line + settings + "\n";
+    }
+
+    return table;
+}
+
+string formatCsv( const vector<string>& configs,
+                  const vector<BatchJob>& jobs )
+{
+    string csv, settings;
+    char line[256], one[24], two[24], three[24], four[24];
+    unsigned int index, setting;
+    double response, turnaround, waiting;
+
+    csv = "config,workload,settings,status,elapsed_sec,completed,"
+          "average_response_sec,average_turnaround_sec,average_waiting_sec,"
+          "cpu_utilization\n";
+    for( index = 0; index < jobs.size(); index++ )
+    {
+        const BatchJob& job = jobs[index];
+
+        settings = "";
+        for( setting = 0; setting < job.settings.size(); setting++ )
+        {
+            settings += ( setting > 0 ? "; " : "" ) + job.settings[setting];
+        }
+
+        csv += quoted( configs[job.config], '"' ) + ","
+               + quoted( job.workload, '"' ) + "," + quoted( settings, '"' );
+        if( job.failed )
+        {
+            csv += ",failed,,,,,,\n";
+            continue;
+        }
+
+        job.report.averages( response, turnaround, waiting );
+        snprintf( line, sizeof( line ), ",ok,%s,%d,%s,%s,%s,%.4f\n",
+                  seconds( job.report.getElapsed(), one ),
+                  job.report.getCompleted(), averageSeconds( response, two ),
+                  averageSeconds( turnaround, three ),
+                  averageSeconds( waiting, four ),
+                  job.report.getCpuUtilization() );
+        csv += line;
+    }
+
+    return csv;
+}
+
+string formatJson( const vector<string>& configs,
+                   const vector<BatchJob>& jobs )
+{
+    string json, settings;
+    char line[512], one[24], two[24], three[24], four[24];
+    unsigned int index, setting;
+    double response, turnaround, waiting;
+
+    json = "[";
+    for( index = 0; index < jobs.size(); index++ )
+    {
+        const BatchJob& job = jobs[index];
+
+        settings = "";
+        for( setting = 0; setting < job.settings.size(); setting++ )
+        {
+            settings += ( setting > 0 ? ", " : "" )
+                        + quoted( job.settings[setting], '\\' );
+        }
+
+        json += ( index > 0 ? ",\n  { \"config\": " : "\n  { \"config\": " )
+                + quoted( configs[job.config], '\\' ) + ", \"workload\": "
+                + quoted( job.workload, '\\' ) + ", \"settings\": ["
+                + settings + "], ";
+        if( job.failed )
+        {
+            json += "\"status\": \"failed\" }";
+            continue;
+        }
+
+        job.report.averages( response, turnaround, waiting );
+        snprintf( line, sizeof( line ),
+                  "\"status\": \"ok\", \"elapsed_sec\": %s, "
+                  "\"completed\": %d, \"average_response_sec\": %s, "
+                  "\"average_turnaround_sec\": %s, "
+                  "\"average_waiting_sec\": %s, \"cpu_utilization\": %.4f }",
+                  seconds( job.report.getElapsed(), one ),
+                  job.report.getCompleted(), averageSeconds( response, two ),
+                  averageSeconds( turnaround, three ),
+                  averageSeconds( waiting, four ),
+                  job.report.getCpuUtilization() );
+        json += line;
+    }
+    json += "\n]\n";
+
+    return json;
+}